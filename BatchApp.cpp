@@ -0,0 +1,112 @@
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "BatchCategorization.hpp"
+
+
+/// <summary>
+/// Headless entry point: categorization of all objects in a dataset directory or a chain code container.
+/// Usage: ObjectCategorizationBatch <input directory or container> [output directory or feature store] [rotation] [scale] [--bands N] [--rotated]
+/// If the output path ends with ".fvs", all feature vectors are written into a single binary feature store.
+/// The option --bands splits the sweep lines of every angle into N parallel bands (see LineSweeping::setSweepBandCount).
+/// Without it (or with N = 0), the band count is chosen from the number of threads and tasks (see scheduledBandCount).
+/// The option --rotated sweeps every angle as a row sweep of the rotated contour (see SweepMode::rotatedContour).
+/// </summary>
+int main(int argc, char* argv[]) {
+	// Separating the options from the positional arguments.
+	std::vector<std::string> arguments;
+	std::string bandCountArgument = "0";
+	bool isRotated = false;
+	bool isUsageValid = true;
+	for (int i = 1; i < argc; i++) {
+		const std::string argument = argv[i];
+		if (argument == "--bands") {
+			if (i + 1 < argc) {
+				bandCountArgument = argv[++i];
+			}
+			else {
+				isUsageValid = false;
+			}
+		}
+		else if (argument == "--rotated") {
+			isRotated = true;
+		}
+		else {
+			arguments.push_back(argument);
+		}
+	}
+
+	// Without an input directory, we only print the usage.
+	if (arguments.empty() || !isUsageValid) {
+		std::cerr << "Usage: " << argv[0] << " <input directory or container> [output directory or feature store = ./Results/] [rotation = 0] [scale = 1] [--bands N = automatic] [--rotated]\n";
+		return 1;
+	}
+
+	const std::string inputDirectory = arguments[0];
+	const std::string outputDirectory = arguments.size() > 1 ? arguments[1] : "./Results/";
+	uint rotation = 0;
+	uint scale = 1;
+	SweepSettings settings;
+	settings.mode = isRotated ? SweepMode::rotatedContour : SweepMode::sweepLines;
+
+	try {
+		rotation = arguments.size() > 2 ? static_cast<uint>(std::stoul(arguments[2])) : 0;
+		scale = arguments.size() > 3 ? static_cast<uint>(std::stoul(arguments[3])) : 1;
+		settings.bandCount = static_cast<uint>(std::stoul(bandCountArgument));
+	}
+	catch (const std::exception&) {
+		std::cerr << "Rotation, scale and band count must be non-negative integers.\n";
+		return 1;
+	}
+
+	if (rotation > 7 || scale < 1) {
+		std::cerr << "Rotation must be in range 0-7 and scale must be at least 1.\n";
+		return 1;
+	}
+
+	// Categorization of all objects in the directory (or in the container if the input is a file).
+	std::error_code error;
+	const bool isContainer = std::filesystem::is_regular_file(inputDirectory, error);
+	auto start = std::chrono::steady_clock::now();
+	ParseError containerError;
+	const std::vector<BatchResult> results = isContainer ? categorizeContainer(inputDirectory, rotation, scale, settings, containerError) : categorizeDirectory(inputDirectory, rotation, scale, settings);
+	auto end = std::chrono::steady_clock::now();
+
+	if (results.empty()) {
+		if (isContainer && !containerError.message.empty()) {
+			std::cerr << "Container " << inputDirectory << " could not be read (" << containerError.toString() << ").\n";
+		}
+		else {
+			std::cerr << "No chain code files found in " << inputDirectory << ".\n";
+		}
+		return 1;
+	}
+
+	// Reporting the result of each object.
+	uint failures = 0;
+	for (const BatchResult& result : results) {
+		if (result.success) {
+			std::cout << result.name << ": " << result.featureVector.chainLengths.size() << " chains\n";
+		}
+		else {
+			std::cerr << result.name << ": FAILED (" << result.file << ", " << result.error << ")\n";
+			failures++;
+		}
+	}
+
+	// Writing a binary feature store (if the output is a .fvs file) or one text file per object.
+	const bool isFeatureStore = std::filesystem::path(outputDirectory).extension() == ".fvs";
+	if (!(isFeatureStore ? writeFeatureStore(results, outputDirectory) : writeResults(results, outputDirectory))) {
+		std::cerr << "Feature vectors could not be written to " << outputDirectory << ".\n";
+		return 1;
+	}
+
+	const u128 time = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+	std::cout << "Objects: " << results.size() - failures << "/" << results.size() << "\n";
+	std::cout << "Time: " << time << " ms\n";
+
+	return failures == 0 ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,141 @@
+#include <algorithm>
+#include <filesystem>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "BatchCategorization.hpp"
+#include "ChainCodeContainer.hpp"
+#include "FeatureStoreWriter.hpp"
+#include "MultiSweep.hpp"
+
+
+std::vector<std::string> listChainCodeFiles(const std::string& directory) {
+	std::vector<std::string> files;
+
+	// If the directory does not exist, there are no files to list.
+	std::error_code error;
+	if (!std::filesystem::is_directory(directory, error)) {
+		return files;
+	}
+
+	for (const auto& entry : std::filesystem::directory_iterator(directory, error)) {
+		if (entry.is_regular_file() && entry.path().extension() == ".txt") {
+			files.push_back(entry.path().string());
+		}
+	}
+
+	// Sorting the files so that the output does not depend on the file system order.
+	std::sort(files.begin(), files.end());
+
+	return files;
+}
+
+uint scheduledBandCount(const uint bandCount, const size_t objectCount) {
+	// If the band count is requested, the scheduler keeps it.
+	if (bandCount > 0) {
+		return bandCount;
+	}
+
+#ifdef _OPENMP
+	const size_t threadCount = static_cast<size_t>(omp_get_max_threads());
+#else
+	const size_t threadCount = 1;
+#endif
+
+	// The bands are only worth their tasks if the objects and angles alone cannot keep all threads busy.
+	const size_t angleCount = (MULTISWEEP_FINAL_ANGLE - MULTISWEEP_START_ANGLE) / MULTISWEEP_STEP;
+	const size_t taskCount = std::max<size_t>(objectCount * angleCount, 1);
+
+	return static_cast<uint>((threadCount + taskCount - 1) / taskCount);
+}
+
+std::vector<BatchResult> categorizeDirectory(const std::string& directory, const uint rotation, const uint scale, const SweepSettings& settings) {
+	const std::vector<std::string> files = listChainCodeFiles(directory);
+	std::vector<BatchResult> results(files.size());
+
+	SweepSettings objectSettings = settings;
+	objectSettings.bandCount = scheduledBandCount(settings.bandCount, files.size());
+
+	// Each object is a task and so is each of its sweep angles (and each band of its sweep lines). Idle threads take over
+	// the angles of any object, so a few large objects or slow diagonal angles do not leave the other threads waiting.
+	#pragma omp parallel
+	#pragma omp single
+	for (int i = 0; i < static_cast<int>(files.size()); i++) {
+		#pragma omp task firstprivate(i) shared(files, results, rotation, scale, objectSettings)
+		{
+			BatchResult& result = results[i];
+			result.file = files[i];
+			result.name = std::filesystem::path(files[i]).stem().string();
+			result.success = categorizeFile(files[i], rotation, scale, objectSettings, result.featureVector, result.error);
+		}
+	}
+
+	return results;
+}
+
+std::vector<BatchResult> categorizeContainer(const std::string& path, const uint rotation, const uint scale, const SweepSettings& settings, ParseError& error) {
+	std::vector<BatchResult> results;
+
+	// If the container cannot be opened, there are no objects to categorize.
+	ChainCodeContainer container;
+	if (!container.open(path, error)) {
+		return results;
+	}
+	results.resize(container.size());
+
+	SweepSettings objectSettings = settings;
+	objectSettings.bandCount = scheduledBandCount(settings.bandCount, results.size());
+
+	// Each object is a task and so is each of its sweep angles (same as for a directory).
+	#pragma omp parallel
+	#pragma omp single
+	for (int i = 0; i < static_cast<int>(results.size()); i++) {
+		#pragma omp task firstprivate(i) shared(path, container, results, rotation, scale, objectSettings)
+		{
+			BatchResult& result = results[i];
+			result.file = path;
+			result.name = container.name(i);
+			result.success = categorizeContainerObject(container, i, rotation, scale, objectSettings, result.featureVector, result.error);
+		}
+	}
+
+	return results;
+}
+
+bool writeResults(const std::vector<BatchResult>& results, const std::string& path) {
+	// Creating the output directory if it does not exist yet.
+	std::error_code error;
+	std::filesystem::create_directories(path, error);
+	if (!std::filesystem::is_directory(path, error)) {
+		return false;
+	}
+
+	const std::string directory = (std::filesystem::path(path) / "").string();
+
+	bool success = true;
+	for (const BatchResult& result : results) {
+		if (result.success) {
+			success = result.featureVector.writeToFile(result.name + ".txt", directory) && success;
+		}
+	}
+
+	return success;
+}
+
+bool writeFeatureStore(const std::vector<BatchResult>& results, const std::string& path) {
+	FeatureStoreWriter writer;
+	if (!writer.open(path)) {
+		return false;
+	}
+
+	bool success = true;
+	for (const BatchResult& result : results) {
+		if (result.success) {
+			success = writer.add(result.name, result.featureVector) && success;
+		}
+	}
+
+	return writer.close() && success;
+}
\ No newline at end of file
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "ChainCodeReader.hpp"
+#include "Constants.hpp"
+#include "FeatureVector.hpp"
+#include "MultiSweep.hpp"
+
+
+/// <summary>
+/// Structure with the categorization result of a single object file.
+/// </summary>
+struct BatchResult {
+	std::string file;			  // Path to the chain code file.
+	std::string name;			  // Name of the object (file name without the extension).
+	bool success = false;		  // True if the object was successfully categorized.
+	FeatureVector featureVector;  // Calculated feature vector of the object.
+	std::string error;			  // Description of the error if the object could not be categorized.
+};
+
+
+/// <summary>
+/// Listing all chain code files (*.txt) in a directory, sorted by name.
+/// </summary>
+/// <param name="directory">: path to the dataset directory</param>
+/// <returns>list of chain code file paths</returns>
+std::vector<std::string> listChainCodeFiles(const std::string& directory);
+
+/// <summary>
+/// Band count of the sweep lines chosen by the batch scheduler. If the objects and their sweep angles give fewer tasks
+/// than there are threads, the sweep lines of every angle are split into enough bands to keep all threads busy.
+/// </summary>
+/// <param name="bandCount">: requested band count (0 to choose it automatically)</param>
+/// <param name="objectCount">: number of categorized objects</param>
+/// <returns>band count of every sweep angle</returns>
+uint scheduledBandCount(const uint bandCount, const size_t objectCount);
+
+/// <summary>
+/// Categorization of all objects in a dataset directory. The objects and their sweep angles are processed as parallel tasks.
+/// </summary>
+/// <param name="directory">: path to the dataset directory</param>
+/// <param name="rotation">: rotation on the level of the F8 chain code (0-7)</param>
+/// <param name="scale">: scale on the level of the F8 chain code (1-n)</param>
+/// <param name="settings">: settings of the line sweeping</param>
+/// <returns>categorization results of all objects (in the order of the file names)</returns>
+std::vector<BatchResult> categorizeDirectory(const std::string& directory, const uint rotation, const uint scale, const SweepSettings& settings);
+
+/// <summary>
+/// Categorization of all objects in a chain code container. The objects and their sweep angles are processed as parallel tasks.
+/// </summary>
+/// <param name="path">: path to the chain code container</param>
+/// <param name="rotation">: rotation on the level of the F8 chain code (0-7)</param>
+/// <param name="scale">: scale on the level of the F8 chain code (1-n)</param>
+/// <param name="settings">: settings of the line sweeping</param>
+/// <param name="error">: description of the error if the container cannot be opened (output)</param>
+/// <returns>categorization results of all objects (in the order of the container)</returns>
+std::vector<BatchResult> categorizeContainer(const std::string& path, const uint rotation, const uint scale, const SweepSettings& settings, ParseError& error);
+
+/// <summary>
+/// Output of all successfully calculated feature vectors into a directory (one file per object).
+/// </summary>
+/// <param name="results">: categorization results</param>
+/// <param name="path">: path on the drive where the feature vectors should be stored</param>
+/// <returns>true if success, false otherwise</returns>
+bool writeResults(const std::vector<BatchResult>& results, const std::string& path);
+
+/// <summary>
+/// Output of all successfully calculated feature vectors into a single binary feature store (see FeatureStore).
+/// </summary>
+/// <param name="results">: categorization results</param>
+/// <param name="path">: path to the feature store file</param>
+/// <returns>true if success, false otherwise</returns>
+bool writeFeatureStore(const std::vector<BatchResult>& results, const std::string& path);
\ No newline at end of file
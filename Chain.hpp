@@ -8,23 +8,57 @@
 
 
 /// <summary>
-/// Chain structure.
+/// Chain structure. The end points, the length and the number of pixels are maintained while the chain is built,
+/// so the pixels themselves only have to be kept if the whole chain is needed (e.g. for plotting).
 /// </summary>
 struct Chain {
-	std::vector<Pixel> pixels;  // The obtained pixels.
+	std::vector<Pixel> pixels;  // The obtained pixels (only if they are kept).
+	Pixel firstPixel;			// First pixel of the chain.
+	Pixel lastPixel;			// Last pixel of the chain.
+	double length = 0.0;		// Total length of all line segments between the pixel pairs.
+	uint pixelCount = 0;		// Number of obtained pixels.
+	bool keepsPixels = true;	// Whether the obtained pixels are kept.
 	double angle = 0.0;			// Sweep-line angle.
 
 	/// <summary>
-	/// Calculation of the total length of all line segments between the pixel pairs.
+	/// Adding a pixel at the end of the chain.
 	/// </summary>
-	/// <returns>total length of the chain</returns>
-	double totalLength() const {
-		double length = 0.0;
+	/// <param name="pixel">: added pixel</param>
+	void append(const Pixel& pixel) {
+		if (pixelCount == 0) {
+			firstPixel = pixel;
+		}
+		else {
+			length += LineSegment(lastPixel, pixel).length();
+		}
+
+		lastPixel = pixel;
+		pixelCount++;
+
+		if (keepsPixels) {
+			pixels.push_back(pixel);
+		}
+	}
 
-		for (uint i = 1; i < pixels.size(); i++) {
-			length += LineSegment(pixels[i - 1], pixels[i]).length();
+	/// <summary>
+	/// Transformation of all pixels of the chain (including the end points).
+	/// </summary>
+	/// <param name="transform">: function that returns the transformed pixel</param>
+	template <typename Transform>
+	void transform(const Transform& transform) {
+		firstPixel = transform(firstPixel);
+		lastPixel = transform(lastPixel);
+
+		for (Pixel& pixel : pixels) {
+			pixel = transform(pixel);
 		}
+	}
 
+	/// <summary>
+	/// Total length of all line segments between the pixel pairs.
+	/// </summary>
+	/// <returns>total length of the chain</returns>
+	double totalLength() const {
 		return length;
 	}
-};
+};
\ No newline at end of file
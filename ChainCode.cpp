@@ -1,9 +1,10 @@
 #include <algorithm>
 
 #include "ChainCode.hpp"
+#include "ChainCodeDirection.hpp"
 
 
-ChainCode::ChainCode(const std::string& chainCode, const bool clockwise, const Pixel& startPoint, const uint rotation, const uint scale, const bool isF4) :
+ChainCode::ChainCode(const std::string_view chainCode, const bool clockwise, const Pixel& startPoint, const uint rotation, const uint scale, const bool isF4) :
 	clockwise(clockwise),
 	startPoint(startPoint)
 
@@ -11,50 +12,13 @@ ChainCode::ChainCode(const std::string& chainCode, const bool clockwise, const P
 	this->scale = scale;
 
 	// Reading the chain code character by character.
-	for (const char& ch : chainCode) {
-		uint order = ch - '0';
-		if (isF4) {
-			order *= 2;
-		}
-		order = (order + rotation) % 8;
-		
-		// If a value is 0, 1, 2 or 3, the value is added to the chain code vector.
-		if (order == 0 || order == 2 || order == 4 || order == 6) {
-			for (uint i = 0; i < scale; i++) {
-				code.push_back(order);
-			}
-		}
-		else if (order == 1) {
-			for (uint i = 0; i < scale; i++) {
-				code.push_back(0);
-			}
-			for (uint i = 0; i < scale; i++) {
-				code.push_back(2);
-			}
-		}
-		else if (order == 3) {
-			for (uint i = 0; i < scale; i++) {
-				code.push_back(2);
-			}
-			for (uint i = 0; i < scale; i++) {
-				code.push_back(4);
-			}
-		}
-		else if (order == 5) {
-			for (uint i = 0; i < scale; i++) {
-				code.push_back(4);
-			}
-			for (uint i = 0; i < scale; i++) {
-				code.push_back(6);
-			}
-		}
-		else if (order == 7) {
-			for (uint i = 0; i < scale; i++) {
-				code.push_back(6);
-			}
-			for (uint i = 0; i < scale; i++) {
-				code.push_back(0);
-			}
+	for (const char ch : chainCode) {
+		// Converting the character to an F8 command with the given rotation and expanding it into F4 commands,
+		// each of them added as a run of the scale length.
+		const ChainCodeDirection::Expansion& expansion = ChainCodeDirection::EXPANSIONS[ChainCodeDirection::command(ch, isF4, rotation)];
+		appendRun(expansion.first, scale);
+		if (expansion.count == 2) {
+			appendRun(expansion.second, scale);
 		}
 	}
 
@@ -65,17 +29,33 @@ ChainCode::ChainCode(const std::string& chainCode, const bool clockwise, const P
 }
 
 void ChainCode::flipOrientation() {
-	// In order to reverse a chain code, the vector must be reversed along with the chain code instructions.
-	std::reverse(code.begin(), code.end());
+	// In order to reverse a chain code, the runs must be reversed along with the chain code instructions.
+	std::reverse(runs.begin(), runs.end());
 	std::transform(
-		code.begin(),
-		code.end(),
-		code.begin(),
-		[](const char& element) {
-			return static_cast<short>(((element + 4) % 8));
+		runs.begin(),
+		runs.end(),
+		runs.begin(),
+		[](ChainCodeRun run) {
+			run.direction = ChainCodeDirection::opposite(run.direction);
+			return run;
 		}
 	);
 
 	// Flipping orientation property.
 	clockwise = !clockwise;
+}
+
+void ChainCode::appendRun(const short direction, const uint count) {
+	// Empty runs are not stored.
+	if (count == 0) {
+		return;
+	}
+
+	if (!runs.empty() && runs.back().direction == direction) {
+		runs.back().count += count;
+	}
+	else {
+		runs.push_back(ChainCodeRun{ direction, count });
+	}
+	length += count;
 }
\ No newline at end of file
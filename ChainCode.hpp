@@ -1,6 +1,6 @@
 #pragma once
 
-#include <string>
+#include <string_view>
 #include <vector>
 
 #include "Constants.hpp"
@@ -8,28 +8,67 @@
 
 
 /// <summary>
-/// Structure for storing a chain code.
+/// Run of equal chain code commands.
+/// </summary>
+struct ChainCodeRun {
+	short direction = 0;  // Chain code command.
+	uint count = 0;		  // Number of repetitions of the command.
+};
+
+
+/// <summary>
+/// Structure for storing a chain code. The commands are stored as runs of equal commands,
+/// so a scaled chain code takes as much memory as the original one.
 /// </summary>
 struct ChainCode {
-	std::vector<short> code;  // Sequence of chain code commands.
-	bool clockwise;			  // Clockwise orientation (true or false).
+	std::vector<ChainCodeRun> runs;  // Sequence of runs of chain code commands.
+	size_t length = 0;				 // Total number of chain code commands.
+	bool clockwise;					 // Clockwise orientation (true or false).
 	short scale = 1;
-	Pixel startPoint;	      // Start point of the object.
+	Pixel startPoint;				 // Start point of the object.
 
 	/// <summary>
 	/// Constructor of the structure.
 	/// </summary>
-	/// <param name="chainCode">: string that forms the F8 chain code</param>
+	/// <param name="chainCode">: characters that form the F8 chain code</param>
 	/// <param name="clockwise">: clockwise orientation if true, anti-clockwise otherwise</param>
 	/// <param name="startPoint">: starting pixel in the raster space</param>
 	/// <param name="rotation">: rotation on the level of the F8 chain code (0-7)</param>
 	/// <param name="rotation">: scale on the level of the F8 chain code (1-n)</param>
 	/// <param name="isF4">: true if the given code is F4, false otherwise</param>
-	ChainCode(const std::string& chainCode, const bool clockwise, const Pixel& startPoint, const uint rotation = 0, const uint scale = 0, const bool isF4 = false);
+	ChainCode(const std::string_view chainCode, const bool clockwise, const Pixel& startPoint, const uint rotation = 0, const uint scale = 0, const bool isF4 = false);
+
+	/// <summary>
+	/// Number of chain code commands.
+	/// </summary>
+	/// <returns>total length of all runs</returns>
+	size_t size() const {
+		return length;
+	}
+
+	/// <summary>
+	/// First chain code command.
+	/// </summary>
+	/// <returns>first command</returns>
+	short front() const {
+		return runs.front().direction;
+	}
+
+	/// <summary>
+	/// Last chain code command.
+	/// </summary>
+	/// <returns>last command</returns>
+	short back() const {
+		return runs.back().direction;
+	}
 
 	/// <summary>
 	/// Method for flipping the chain code orientation from clockwise to anti-clockwise and vice-versa.
 	/// </summary>
 	void flipOrientation();
+
+private:
+	// Appending a run of commands (merged with the last run if the command is the same).
+	void appendRun(const short direction, const uint count);
 };
 
@@ -0,0 +1,200 @@
+#include "ChainCodeContainer.hpp"
+#include "ContainerCursor.hpp"
+
+
+// PRIVATE HELPER METHODS
+// Offset of the object with the given index.
+size_t ChainCodeContainer::objectOffset(const uint index) const {
+	uint64_t offset = 0;
+	const size_t entry = indexOffset + 8 * static_cast<size_t>(index);
+	for (size_t i = 0; i < 8; i++) {
+		offset |= static_cast<uint64_t>(static_cast<uint8_t>(data[entry + i])) << (8 * i);
+	}
+
+	return static_cast<size_t>(offset);
+}
+
+
+
+// PUBLIC METHODS
+bool ChainCodeContainer::open(const std::string& path, ParseError& error) {
+	file = std::make_unique<MappedFile>(path);
+	data = std::string_view();
+	indexOffset = 0;
+	objectCount = 0;
+
+	// If the file cannot be opened, we do not panic but abort the process.
+	if (!file->isOpen()) {
+		error.offset = 0;
+		error.message = "file " + path + " cannot be opened";
+		return false;
+	}
+	const std::string_view contents = file->text();
+
+	// Checking the header.
+	ContainerCursor header(contents, 0, error);
+	std::string_view magic;
+	uint64_t version = 0;
+	if (!header.bytes(CONTAINER_MAGIC.size(), magic, "header")) {
+		return false;
+	}
+	if (magic != CONTAINER_MAGIC) {
+		return ContainerCursor(contents, 0, error).fail("not a chain code container");
+	}
+	if (!header.number(4, version, "header")) {
+		return false;
+	}
+	if (version != CONTAINER_VERSION) {
+		return ContainerCursor(contents, 4, error).fail("unsupported container version " + std::to_string(version));
+	}
+
+	// Checking the footer and the index.
+	if (contents.size() < CONTAINER_HEADER_SIZE + CONTAINER_FOOTER_SIZE) {
+		return header.fail("missing footer");
+	}
+
+	const size_t footerOffset = contents.size() - CONTAINER_FOOTER_SIZE;
+	ContainerCursor footer(contents, footerOffset, error);
+	uint64_t index = 0;
+	uint64_t count = 0;
+	std::string_view indexMagic;
+	if (!footer.number(8, index, "footer") || !footer.number(4, count, "footer") || !footer.bytes(CONTAINER_INDEX_MAGIC.size(), indexMagic, "footer")) {
+		return false;
+	}
+	if (indexMagic != CONTAINER_INDEX_MAGIC) {
+		return ContainerCursor(contents, footerOffset + 12, error).fail("missing footer");
+	}
+	if (index < CONTAINER_HEADER_SIZE || index > footerOffset || (footerOffset - index) != 8 * count) {
+		return ContainerCursor(contents, footerOffset, error).fail("invalid index");
+	}
+
+	data = contents;
+	indexOffset = static_cast<size_t>(index);
+	objectCount = static_cast<uint>(count);
+
+	return true;
+}
+
+uint ChainCodeContainer::size() const {
+	return objectCount;
+}
+
+std::string ChainCodeContainer::name(const uint index) const {
+	// If the object does not exist, it has no name.
+	if (index >= objectCount) {
+		return "";
+	}
+
+	ParseError error;
+	ContainerCursor cursor(data, objectOffset(index), error);
+	uint64_t nameLength = 0;
+	std::string_view objectName;
+	if (!cursor.number(2, nameLength, "object name") || !cursor.bytes(static_cast<size_t>(nameLength), objectName, "object name")) {
+		return "";
+	}
+
+	return std::string(objectName);
+}
+
+bool ChainCodeContainer::readRecords(const uint index, std::vector<ChainCodeRecord>& records, std::string& buffer, ParseError& error) const {
+	records.clear();
+	buffer.clear();
+
+	if (index >= objectCount) {
+		error.offset = 0;
+		error.message = "object " + std::to_string(index) + " does not exist";
+		return false;
+	}
+
+	// Skipping the name of the object.
+	ContainerCursor cursor(data, objectOffset(index), error);
+	uint64_t nameLength = 0;
+	uint64_t recordCount = 0;
+	std::string_view objectName;
+	if (!cursor.number(2, nameLength, "object name") || !cursor.bytes(static_cast<size_t>(nameLength), objectName, "object name") || !cursor.number(4, recordCount, "record count")) {
+		return false;
+	}
+
+	// Reading the record headers and the packed commands.
+	std::vector<std::string_view> packedCommands;
+	std::vector<size_t> commandCounts;
+	for (uint64_t i = 0; i < recordCount; i++) {
+		uint64_t flags = 0;
+		uint64_t startX = 0;
+		uint64_t startY = 0;
+		uint64_t commandCount = 0;
+		if (!cursor.number(1, flags, "record") || !cursor.number(4, startX, "record") || !cursor.number(4, startY, "record") || !cursor.number(4, commandCount, "record")) {
+			return false;
+		}
+
+		// A record without commands cannot be turned into coordinates.
+		if (commandCount == 0) {
+			return cursor.fail("empty chain code");
+		}
+
+		ChainCodeRecord record;
+		record.isF4 = flags & CONTAINER_FLAG_F4;
+		record.clockwise = flags & CONTAINER_FLAG_CLOCKWISE;
+		record.startX = static_cast<int32_t>(static_cast<uint32_t>(startX));
+		record.startY = static_cast<int32_t>(static_cast<uint32_t>(startY));
+
+		const size_t bits = record.isF4 ? 2 : 3;
+		std::string_view packed;
+		if (!cursor.bytes((static_cast<size_t>(commandCount) * bits + 7) / 8, packed, "commands")) {
+			return false;
+		}
+
+		records.push_back(record);
+		packedCommands.push_back(packed);
+		commandCounts.push_back(static_cast<size_t>(commandCount));
+	}
+
+	// Unpacking the commands into digits (the buffer is allocated once, so the records can point into it).
+	size_t totalCount = 0;
+	for (const size_t count : commandCounts) {
+		totalCount += count;
+	}
+	buffer.resize(totalCount);
+
+	size_t start = 0;
+	for (size_t i = 0; i < records.size(); i++) {
+		const uint bits = records[i].isF4 ? 2 : 3;
+		const uint mask = (1u << bits) - 1;
+		const std::string_view packed = packedCommands[i];
+		char* output = buffer.data() + start;
+
+		for (size_t j = 0; j < commandCounts[i]; j++) {
+			// A command may span two bytes.
+			const size_t bit = j * bits;
+			const size_t byte = bit / 8;
+			uint window = static_cast<uint8_t>(packed[byte]);
+			if (byte + 1 < packed.size()) {
+				window |= static_cast<uint>(static_cast<uint8_t>(packed[byte + 1])) << 8;
+			}
+
+			output[j] = static_cast<char>('0' + ((window >> (bit % 8)) & mask));
+		}
+
+		records[i].code = std::string_view(buffer.data() + start, commandCounts[i]);
+		start += commandCounts[i];
+	}
+
+	return true;
+}
+
+bool ChainCodeContainer::readChainCodes(const uint index, const uint rotation, const uint scale, std::vector<ChainCode>& chainCodes, ParseError& error) const {
+	chainCodes.clear();
+
+	std::vector<ChainCodeRecord> records;
+	std::string buffer;
+	if (!readRecords(index, records, buffer, error)) {
+		return false;
+	}
+
+	chainCodes.reserve(records.size());
+	for (const ChainCodeRecord& record : records) {
+		chainCodes.push_back(createChainCode(record, rotation, scale));
+	}
+
+	return true;
+}
\ No newline at end of file
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ChainCode.hpp"
+#include "ChainCodeReader.hpp"
+#include "Constants.hpp"
+#include "MappedFile.hpp"
+
+
+// CONSTANTS
+// Layout of a chain code container (all numbers are little-endian):
+//   header:  magic "CCB1", uint32 version
+//   objects: uint16 name length, name, uint32 record count and the records of the object, where each record is
+//            uint8 flags (bit 0: F4, bit 1: clockwise), int32 start X, int32 start Y, uint32 command count and
+//            the commands packed into 2 (F4) or 3 (F8) bits each, starting with the lowest bits of the first byte
+//   index:   uint64 offset of each object
+//   footer:  uint64 offset of the index, uint32 object count, magic "CCBI"
+const std::string_view CONTAINER_MAGIC = "CCB1";		// Magic number at the beginning of a container.
+const std::string_view CONTAINER_INDEX_MAGIC = "CCBI";	// Magic number at the end of a container.
+const uint32_t CONTAINER_VERSION = 1;					// Version of the container layout.
+const size_t CONTAINER_HEADER_SIZE = 8;					// Size of the header in bytes.
+const size_t CONTAINER_FOOTER_SIZE = 16;				// Size of the footer in bytes.
+const uint8_t CONTAINER_FLAG_F4 = 0b01;					// Record flag for F4 commands.
+const uint8_t CONTAINER_FLAG_CLOCKWISE = 0b10;			// Record flag for the clockwise orientation.
+
+
+/// <summary>
+/// Read-only binary container with the chain codes of many objects. The container is memory-mapped
+/// and every object can be read directly through the index at the end of the file.
+/// </summary>
+class ChainCodeContainer {
+private:
+	std::unique_ptr<MappedFile> file;  // Mapped container file.
+	std::string_view data;			   // Contents of the container.
+	size_t indexOffset = 0;			   // Offset of the index of objects.
+	uint objectCount = 0;			   // Number of objects in the container.
+
+	// Offset of the object with the given index.
+	size_t objectOffset(const uint index) const;
+
+public:
+	/// <summary>
+	/// Opening a container file and checking its header and index.
+	/// </summary>
+	/// <param name="path">: path to the container file</param>
+	/// <param name="error">: description of the error (output)</param>
+	/// <returns>true if success, false otherwise</returns>
+	bool open(const std::string& path, ParseError& error);
+
+	/// <summary>
+	/// Number of objects in the container.
+	/// </summary>
+	/// <returns>number of objects</returns>
+	uint size() const;
+
+	/// <summary>
+	/// Name of an object.
+	/// </summary>
+	/// <param name="index">: index of the object</param>
+	/// <returns>name of the object (empty if the object cannot be read)</returns>
+	std::string name(const uint index) const;
+
+	/// <summary>
+	/// Reading the records of an object. The commands of all records are unpacked into the buffer as digits.
+	/// </summary>
+	/// <param name="index">: index of the object</param>
+	/// <param name="records">: records of the object that point into the buffer (output)</param>
+	/// <param name="buffer">: buffer with the unpacked commands (output)</param>
+	/// <param name="error">: description of the error (output)</param>
+	/// <returns>true if success, false otherwise</returns>
+	bool readRecords(const uint index, std::vector<ChainCodeRecord>& records, std::string& buffer, ParseError& error) const;
+
+	/// <summary>
+	/// Reading the chain codes of an object.
+	/// </summary>
+	/// <param name="index">: index of the object</param>
+	/// <param name="rotation">: rotation on the level of the F8 chain code (0-7)</param>
+	/// <param name="scale">: scale on the level of the F8 chain code (1-n)</param>
+	/// <param name="chainCodes">: chain codes of the object (output)</param>
+	/// <param name="error">: description of the error (output)</param>
+	/// <returns>true if success, false otherwise</returns>
+	bool readChainCodes(const uint index, const uint rotation, const uint scale, std::vector<ChainCode>& chainCodes, ParseError& error) const;
+};
\ No newline at end of file
@@ -0,0 +1,100 @@
+#include <limits>
+
+#include "ChainCodeContainerWriter.hpp"
+
+
+// PRIVATE HELPER METHODS
+// Writing raw bytes to the container.
+void ChainCodeContainerWriter::write(const void* bytes, const size_t size) {
+	out.write(static_cast<const char*>(bytes), static_cast<std::streamsize>(size));
+	position += size;
+}
+
+// Writing a little-endian unsigned number with the given number of bytes.
+void ChainCodeContainerWriter::writeNumber(const uint64_t value, const size_t size) {
+	uint8_t bytes[8];
+	for (size_t i = 0; i < size; i++) {
+		bytes[i] = static_cast<uint8_t>(value >> (8 * i));
+	}
+
+	write(bytes, size);
+}
+
+
+
+// PUBLIC METHODS
+bool ChainCodeContainerWriter::open(const std::string& path) {
+	out = std::ofstream(path, std::ios::binary | std::ios::trunc);
+	offsets.clear();
+	position = 0;
+
+	// If a file is not open, we do not panic but abort the process.
+	if (!out.is_open()) {
+		return false;
+	}
+
+	write(CONTAINER_MAGIC.data(), CONTAINER_MAGIC.size());
+	writeNumber(CONTAINER_VERSION, 4);
+
+	return static_cast<bool>(out);
+}
+
+bool ChainCodeContainerWriter::add(const std::string_view name, const std::vector<ChainCodeRecord>& records) {
+	// If the object does not fit into the layout, it is not written.
+	if (!out.is_open() || name.size() > std::numeric_limits<uint16_t>::max() || records.size() > std::numeric_limits<uint32_t>::max()) {
+		return false;
+	}
+	for (const ChainCodeRecord& record : records) {
+		if (record.code.size() > std::numeric_limits<uint32_t>::max()) {
+			return false;
+		}
+	}
+
+	offsets.push_back(position);
+	writeNumber(name.size(), 2);
+	write(name.data(), name.size());
+	writeNumber(records.size(), 4);
+
+	std::vector<uint8_t> packed;
+	for (const ChainCodeRecord& record : records) {
+		const uint8_t flags = (record.isF4 ? CONTAINER_FLAG_F4 : 0) | (record.clockwise ? CONTAINER_FLAG_CLOCKWISE : 0);
+		writeNumber(flags, 1);
+		writeNumber(static_cast<uint32_t>(record.startX), 4);
+		writeNumber(static_cast<uint32_t>(record.startY), 4);
+		writeNumber(record.code.size(), 4);
+
+		// Packing the commands into 2 (F4) or 3 (F8) bits each.
+		const size_t bits = record.isF4 ? 2 : 3;
+		packed.assign((record.code.size() * bits + 7) / 8, 0);
+		for (size_t i = 0; i < record.code.size(); i++) {
+			const uint command = static_cast<uint>(record.code[i] - '0') & ((1u << bits) - 1);
+			const size_t bit = i * bits;
+			packed[bit / 8] |= static_cast<uint8_t>(command << (bit % 8));
+			if (bit % 8 + bits > 8) {
+				packed[bit / 8 + 1] |= static_cast<uint8_t>(command >> (8 - bit % 8));
+			}
+		}
+		write(packed.data(), packed.size());
+	}
+
+	return static_cast<bool>(out);
+}
+
+bool ChainCodeContainerWriter::close() {
+	if (!out.is_open()) {
+		return false;
+	}
+
+	// Writing the index and the footer.
+	const uint64_t indexOffset = position;
+	for (const uint64_t offset : offsets) {
+		writeNumber(offset, 8);
+	}
+	writeNumber(indexOffset, 8);
+	writeNumber(offsets.size(), 4);
+	write(CONTAINER_INDEX_MAGIC.data(), CONTAINER_INDEX_MAGIC.size());
+
+	out.close();
+
+	return !out.fail();
+}
\ No newline at end of file
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ChainCodeContainer.hpp"
+#include "ChainCodeReader.hpp"
+
+
+/// <summary>
+/// Writer of a binary chain code container (see ChainCodeContainer for the layout).
+/// </summary>
+class ChainCodeContainerWriter {
+private:
+	std::ofstream out;				  // Output stream of the container.
+	std::vector<uint64_t> offsets;	  // Offsets of the written objects.
+	uint64_t position = 0;			  // Current offset in the container.
+
+	// Writing raw bytes to the container.
+	void write(const void* bytes, const size_t size);
+
+	// Writing a little-endian unsigned number with the given number of bytes.
+	void writeNumber(const uint64_t value, const size_t size);
+
+public:
+	/// <summary>
+	/// Creating a container file and writing its header.
+	/// </summary>
+	/// <param name="path">: path to the container file</param>
+	/// <returns>true if success, false otherwise</returns>
+	bool open(const std::string& path);
+
+	/// <summary>
+	/// Adding an object to the container.
+	/// </summary>
+	/// <param name="name">: name of the object (at most 65535 bytes)</param>
+	/// <param name="records">: records of the object</param>
+	/// <returns>true if success, false otherwise</returns>
+	bool add(const std::string_view name, const std::vector<ChainCodeRecord>& records);
+
+	/// <summary>
+	/// Writing the index and the footer and closing the container.
+	/// </summary>
+	/// <returns>true if success, false otherwise</returns>
+	bool close();
+};
\ No newline at end of file
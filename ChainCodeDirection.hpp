@@ -0,0 +1,74 @@
+#pragma once
+
+#include <array>
+
+
+// Compile-time tables for decoding chain code commands (directions 0-7, counter-clockwise from the right).
+// Invalid directions (for example -1 for pixels that are not on the edge) do not move a pixel.
+namespace ChainCodeDirection {
+	constexpr std::array<int, 8> MOVE_X = { 1, 1, 0, -1, -1, -1, 0, 1 };  // X component of the move of each direction.
+	constexpr std::array<int, 8> MOVE_Y = { 0, 1, 1, 1, 0, -1, -1, -1 };  // Y component of the move of each direction.
+
+	// Returning true if the value is a valid direction.
+	constexpr bool isValid(const int direction) {
+		return direction >= 0 && direction < 8;
+	}
+
+	// X component of the move in the direction (0 for an invalid direction).
+	constexpr int moveX(const int direction) {
+		return isValid(direction) ? MOVE_X[direction] : 0;
+	}
+
+	// Y component of the move in the direction (0 for an invalid direction).
+	constexpr int moveY(const int direction) {
+		return isValid(direction) ? MOVE_Y[direction] : 0;
+	}
+
+	// Opposite direction.
+	constexpr short opposite(const short direction) {
+		return static_cast<short>((direction + 4) % 8);
+	}
+
+
+	// Table of F8 commands for each code type (0: F8, 1: F4), rotation (0-7) and digit (0-7).
+	constexpr std::array<std::array<std::array<short, 8>, 8>, 2> COMMANDS = [] {
+		std::array<std::array<std::array<short, 8>, 8>, 2> table{};
+		for (int type = 0; type < 2; type++) {
+			for (int rotation = 0; rotation < 8; rotation++) {
+				for (int digit = 0; digit < 8; digit++) {
+					table[type][rotation][digit] = static_cast<short>(((type == 1 ? 2 * digit : digit) + rotation) % 8);
+				}
+			}
+		}
+		return table;
+	}();
+
+	// F8 command of a digit of an F4 or F8 chain code rotated by the given number of steps of 45 degrees.
+	constexpr short command(const char digit, const bool isF4, const unsigned int rotation) {
+		return COMMANDS[isF4 ? 1 : 0][rotation % 8][(digit - '0') & 7];
+	}
+
+
+	// Expansion of an F8 command into one or two F4 commands.
+	struct Expansion {
+		short first = 0;   // First F4 command.
+		short second = 0;  // Second F4 command (only valid if count is 2).
+		int count = 1;	   // Number of F4 commands.
+	};
+
+	// Table of expansions: even commands stay as they are, odd (diagonal) ones become two neighbouring even commands
+	// (1 becomes 0 and 2, 3 becomes 2 and 4, 5 becomes 4 and 6 and 7 becomes 6 and 0).
+	constexpr std::array<Expansion, 8> EXPANSIONS = [] {
+		std::array<Expansion, 8> table{};
+		for (int command = 0; command < 8; command++) {
+			table[command] = command % 2 == 0 ?
+				Expansion{ static_cast<short>(command), static_cast<short>(command), 1 } :
+				Expansion{ static_cast<short>(command - 1), static_cast<short>((command + 1) % 8), 2 };
+		}
+		return table;
+	}();
+
+	static_assert(MOVE_X[1] == 1 && MOVE_Y[1] == 1, "direction 1 moves up and right");
+	static_assert(command('3', true, 1) == 7, "F4 command 3 rotated by 45 degrees is F8 command 7");
+	static_assert(EXPANSIONS[7].first == 6 && EXPANSIONS[7].second == 0, "command 7 becomes 6 and 0");
+}
\ No newline at end of file
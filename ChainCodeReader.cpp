@@ -0,0 +1,205 @@
+#include <charconv>
+
+#include "ChainCodeReader.hpp"
+#include "HelperFunctions.hpp"
+#include "MappedFile.hpp"
+
+
+// CONSTANTS
+const std::string_view CHAIN_CODE_HEADER = "CC Multi";  // First line of every chain code file.
+
+
+// Sequential reader over the file contents that keeps track of the current offset.
+class ChainCodeTokenizer {
+private:
+	std::string_view text;  // Contents of the file.
+	size_t position = 0;	// Current offset.
+	ParseError& error;		// First error.
+
+public:
+	ChainCodeTokenizer(const std::string_view text, ParseError& error) :
+		text(text),
+		error(error)
+	{}
+
+	// Returning true if the whole text has been read.
+	bool atEnd() const {
+		return position >= text.size();
+	}
+
+	// Current offset.
+	size_t offset() const {
+		return position;
+	}
+
+	// Setting the error at the given offset (always returns false).
+	bool fail(const size_t offset, const std::string& message) {
+		error.offset = offset;
+		error.message = message;
+		return false;
+	}
+
+	// Skipping empty lines.
+	void skipEmptyLines() {
+		while (!atEnd() && (text[position] == '\n' || text[position] == '\r')) {
+			position++;
+		}
+	}
+
+	// Reading the rest of the line (without the line break).
+	std::string_view line() {
+		const size_t begin = position;
+		size_t end = text.find('\n', begin);
+		if (end == std::string_view::npos) {
+			end = text.size();
+		}
+		position = end < text.size() ? end + 1 : end;
+
+		// Windows line breaks are accepted as well.
+		std::string_view result = text.substr(begin, end - begin);
+		if (!result.empty() && result.back() == '\r') {
+			result.remove_suffix(1);
+		}
+
+		return result;
+	}
+
+	// Reading a field that ends with the delimiter (the delimiter is skipped, the field cannot span lines).
+	bool field(const char delimiter, std::string_view& result, const char* name) {
+		const size_t begin = position;
+		while (!atEnd() && text[position] != delimiter && text[position] != '\n') {
+			position++;
+		}
+
+		// If the delimiter is missing, the record is incomplete.
+		if (atEnd() || text[position] != delimiter) {
+			return fail(position, std::string("expected '") + delimiter + "' after the " + name);
+		}
+
+		result = text.substr(begin, position - begin);
+		position++;
+
+		return true;
+	}
+
+	// Reading an integer field that ends with the delimiter.
+	bool integer(const char delimiter, int& result, const char* name) {
+		const size_t begin = position;
+		std::string_view value;
+		if (!field(delimiter, value, name)) {
+			return false;
+		}
+
+		const char* last = value.data() + value.size();
+		const auto [end, code] = std::from_chars(value.data(), last, result);
+		if (code != std::errc() || end != last || value.empty()) {
+			return fail(begin, std::string("invalid ") + name + " '" + std::string(value) + "'");
+		}
+
+		return true;
+	}
+};
+
+
+bool parseChainCodeRecords(const std::string_view text, std::vector<ChainCodeRecord>& records, ParseError& error) {
+	records.clear();
+	ChainCodeTokenizer tokenizer(text, error);
+
+	// Checking the header.
+	if (tokenizer.line() != CHAIN_CODE_HEADER) {
+		return tokenizer.fail(0, "missing \"CC Multi\" header");
+	}
+
+	// Reading the records one by one.
+	tokenizer.skipEmptyLines();
+	while (!tokenizer.atEnd()) {
+		// Reading the type of the chain code.
+		const size_t typeOffset = tokenizer.offset();
+		std::string_view type;
+		if (!tokenizer.field(';', type, "chain code type")) {
+			return false;
+		}
+		if (type != "F4" && type != "F8") {
+			return tokenizer.fail(typeOffset, "unknown chain code type '" + std::string(type) + "'");
+		}
+		ChainCodeRecord record;
+		record.isF4 = type == "F4";
+
+		// Reading clockwise or anti-clockwise orientation.
+		const size_t orientationOffset = tokenizer.offset();
+		std::string_view orientation;
+		if (!tokenizer.field(';', orientation, "orientation")) {
+			return false;
+		}
+		if (orientation != "CW" && orientation != "CCW") {
+			return tokenizer.fail(orientationOffset, "unknown orientation '" + std::string(orientation) + "'");
+		}
+		record.clockwise = orientation == "CW";
+
+		// Reading the starting point.
+		if (!tokenizer.integer(',', record.startX, "X coordinate") || !tokenizer.integer(';', record.startY, "Y coordinate")) {
+			return false;
+		}
+
+		// Skipping the level of the contour.
+		std::string_view level;
+		if (!tokenizer.field(';', level, "level")) {
+			return false;
+		}
+
+		// Checking the chain code commands.
+		const size_t codeOffset = tokenizer.offset();
+		const std::string_view code = tokenizer.line();
+		if (code.empty()) {
+			return tokenizer.fail(codeOffset, "empty chain code");
+		}
+
+		const char maxCommand = record.isF4 ? '3' : '7';
+		for (size_t i = 0; i < code.size(); i++) {
+			if (code[i] < '0' || code[i] > maxCommand) {
+				return tokenizer.fail(codeOffset + i, std::string("invalid ") + (record.isF4 ? "F4" : "F8") + " command '" + code[i] + "'");
+			}
+		}
+
+		// Adding a new record.
+		record.code = code;
+		records.push_back(record);
+
+		tokenizer.skipEmptyLines();
+	}
+
+	return true;
+}
+
+ChainCode createChainCode(const ChainCodeRecord& record, const uint rotation, const uint scale) {
+	const Pixel startPixel = rotate2D(Pixel(record.startX, -record.startY), Pixel(0, 0), rotation * (PI / 4));
+	return ChainCode(record.code, record.clockwise, startPixel, rotation, scale, record.isF4);
+}
+
+bool parseChainCodes(const std::string_view text, const uint rotation, const uint scale, std::vector<ChainCode>& chainCodes, ParseError& error) {
+	chainCodes.clear();
+
+	std::vector<ChainCodeRecord> records;
+	if (!parseChainCodeRecords(text, records, error)) {
+		return false;
+	}
+
+	chainCodes.reserve(records.size());
+	for (const ChainCodeRecord& record : records) {
+		chainCodes.push_back(createChainCode(record, rotation, scale));
+	}
+
+	return true;
+}
+
+bool readChainCodes(const std::string& file, const uint rotation, const uint scale, std::vector<ChainCode>& chainCodes, ParseError& error) {
+	// If a file cannot be opened, we do not panic but abort the process.
+	const MappedFile mappedFile(file);
+	if (!mappedFile.isOpen()) {
+		error.offset = 0;
+		error.message = "file " + file + " cannot be opened";
+		return false;
+	}
+
+	return parseChainCodes(mappedFile.text(), rotation, scale, chainCodes, error);
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ChainCode.hpp"
+#include "Constants.hpp"
+
+
+/// <summary>
+/// Structure describing an error in a chain code file.
+/// </summary>
+struct ParseError {
+	size_t offset = 0;	  // Offset of the error from the beginning of the file (in bytes).
+	std::string message;  // Description of the error.
+
+	/// <summary>
+	/// Description of the error together with its offset.
+	/// </summary>
+	/// <returns>error description</returns>
+	std::string toString() const {
+		return "offset " + std::to_string(offset) + ": " + message;
+	}
+};
+
+
+/// <summary>
+/// Structure with a single record of a chain code file, as it is written in the file (without rotation and scale).
+/// </summary>
+struct ChainCodeRecord {
+	bool isF4 = true;		// True if the commands are F4, false if they are F8.
+	bool clockwise = false;	// Clockwise orientation (true or false).
+	int startX = 0;			// X coordinate of the start point.
+	int startY = 0;			// Y coordinate of the start point (as written in the file).
+	std::string_view code;	// Chain code commands as digits (points into the parsed text).
+};
+
+
+/// <summary>
+/// Parsing the records of a "CC Multi" chain code file in place. Each record has the form
+/// "type;orientation;x,y;level;code", where type is F4 or F8 and orientation is CW or CCW.
+/// </summary>
+/// <param name="text">: contents of the file (has to outlive the records)</param>
+/// <param name="records">: parsed records (output)</param>
+/// <param name="error">: description of the first error (output)</param>
+/// <returns>true if success, false otherwise</returns>
+bool parseChainCodeRecords(const std::string_view text, std::vector<ChainCodeRecord>& records, ParseError& error);
+
+/// <summary>
+/// Creating a chain code from a record.
+/// </summary>
+/// <param name="record">: record of a chain code file</param>
+/// <param name="rotation">: rotation on the level of the F8 chain code (0-7)</param>
+/// <param name="scale">: scale on the level of the F8 chain code (1-n)</param>
+/// <returns>chain code</returns>
+ChainCode createChainCode(const ChainCodeRecord& record, const uint rotation, const uint scale);
+
+/// <summary>
+/// Parsing the contents of a "CC Multi" chain code file in place.
+/// </summary>
+/// <param name="text">: contents of the file</param>
+/// <param name="rotation">: rotation on the level of the F8 chain code (0-7)</param>
+/// <param name="scale">: scale on the level of the F8 chain code (1-n)</param>
+/// <param name="chainCodes">: parsed chain codes (output)</param>
+/// <param name="error">: description of the first error (output)</param>
+/// <returns>true if success, false otherwise</returns>
+bool parseChainCodes(const std::string_view text, const uint rotation, const uint scale, std::vector<ChainCode>& chainCodes, ParseError& error);
+
+/// <summary>
+/// Reading a "CC Multi" chain code file through a memory mapping.
+/// </summary>
+/// <param name="file">: path to the chain code file</param>
+/// <param name="rotation">: rotation on the level of the F8 chain code (0-7)</param>
+/// <param name="scale">: scale on the level of the F8 chain code (1-n)</param>
+/// <param name="chainCodes">: parsed chain codes (output)</param>
+/// <param name="error">: description of the first error (output)</param>
+/// <returns>true if success, false otherwise</returns>
+bool readChainCodes(const std::string& file, const uint rotation, const uint scale, std::vector<ChainCode>& chainCodes, ParseError& error);
\ No newline at end of file
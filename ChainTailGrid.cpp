@@ -0,0 +1,56 @@
+#include <algorithm>
+#include <cmath>
+
+#include "ChainTailGrid.hpp"
+
+
+ChainTailGrid::ChainTailGrid(const int maxCoordinate, const double radius) :
+	cellSize(std::max(radius, 1.0))
+{
+	gridSize = static_cast<int>(maxCoordinate / cellSize) + 2;
+	cells = std::vector<std::vector<uint>>(static_cast<size_t>(gridSize) * gridSize);
+}
+
+
+int ChainTailGrid::cellCoordinate(const double coordinate) const {
+	// Coordinates outside of the bounding box are clamped to the border cells.
+	const int cell = static_cast<int>(std::floor(coordinate / cellSize));
+	return std::clamp(cell, 0, gridSize - 1);
+}
+
+uint ChainTailGrid::cellIndex(const Pixel& pixel) const {
+	return cellCoordinate(pixel.y) * gridSize + cellCoordinate(pixel.x);
+}
+
+
+void ChainTailGrid::insert(const uint chainIndex, const Pixel& tail) {
+	if (gridSize == 0) {
+		return;
+	}
+
+	cells[cellIndex(tail)].push_back(chainIndex);
+}
+
+void ChainTailGrid::move(const uint chainIndex, const Pixel& oldTail, const Pixel& newTail) {
+	if (gridSize == 0) {
+		return;
+	}
+
+	const uint oldCell = cellIndex(oldTail);
+	const uint newCell = cellIndex(newTail);
+
+	// If the tail stays in the same cell, there is nothing to do.
+	if (oldCell == newCell) {
+		return;
+	}
+
+	// Removing the chain from the old cell (the order within a cell does not matter).
+	std::vector<uint>& oldChains = cells[oldCell];
+	const auto it = std::find(oldChains.begin(), oldChains.end(), chainIndex);
+	if (it != oldChains.end()) {
+		*it = oldChains.back();
+		oldChains.pop_back();
+	}
+
+	cells[newCell].push_back(chainIndex);
+}
\ No newline at end of file
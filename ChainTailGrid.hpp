@@ -0,0 +1,86 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "Constants.hpp"
+#include "Pixel.hpp"
+
+
+/// <summary>
+/// Uniform grid over the tails (last pixels) of chains. The cell size equals the search radius,
+/// so all tails closer than the radius to a pixel lie in the 3x3 cells around it.
+/// </summary>
+class ChainTailGrid {
+private:
+	std::vector<std::vector<uint>> cells;  // Indices of the chains whose tails lie in each cell.
+	int gridSize = 0;					   // Number of cells in a row (and number of rows).
+	double cellSize = 1.0;				   // Size of a cell in pixels.
+
+	// Cell coordinate of a pixel coordinate.
+	int cellCoordinate(const double coordinate) const;
+
+	// Index of the cell of a pixel.
+	uint cellIndex(const Pixel& pixel) const;
+
+public:
+	static constexpr uint NO_CHAIN = std::numeric_limits<uint>::max();  // Returned if no chain is found.
+
+	/// <summary>
+	/// Default constructor of an empty grid.
+	/// </summary>
+	ChainTailGrid() = default;
+
+	/// <summary>
+	/// Constructor of the grid over the bounding box.
+	/// </summary>
+	/// <param name="maxCoordinate">: maximum coordinate of the bounding box</param>
+	/// <param name="radius">: search radius (and cell size)</param>
+	ChainTailGrid(const int maxCoordinate, const double radius);
+
+	/// <summary>
+	/// Adding a chain tail to the grid.
+	/// </summary>
+	/// <param name="chainIndex">: index of the chain</param>
+	/// <param name="tail">: last pixel of the chain</param>
+	void insert(const uint chainIndex, const Pixel& tail);
+
+	/// <summary>
+	/// Moving a chain tail after the chain has been extended.
+	/// </summary>
+	/// <param name="chainIndex">: index of the chain</param>
+	/// <param name="oldTail">: previous last pixel of the chain</param>
+	/// <param name="newTail">: new last pixel of the chain</param>
+	void move(const uint chainIndex, const Pixel& oldTail, const Pixel& newTail);
+
+	/// <summary>
+	/// Finding the chain with the smallest index among the tails around a pixel that satisfies the predicate.
+	/// The predicate has to reject all tails that are not closer than the radius.
+	/// </summary>
+	/// <param name="center">: pixel in the middle of the search</param>
+	/// <param name="predicate">: condition for the chain index</param>
+	/// <returns>smallest chain index that satisfies the predicate, NO_CHAIN otherwise</returns>
+	template <typename Predicate>
+	uint findFirst(const Pixel& center, const Predicate& predicate) const {
+		uint result = NO_CHAIN;
+		if (gridSize == 0) {
+			return result;
+		}
+
+		const int centerX = cellCoordinate(center.x);
+		const int centerY = cellCoordinate(center.y);
+
+		for (int y = std::max(centerY - 1, 0); y <= std::min(centerY + 1, gridSize - 1); y++) {
+			for (int x = std::max(centerX - 1, 0); x <= std::min(centerX + 1, gridSize - 1); x++) {
+				for (const uint chainIndex : cells[y * gridSize + x]) {
+					if (chainIndex < result && predicate(chainIndex)) {
+						result = chainIndex;
+					}
+				}
+			}
+		}
+
+		return result;
+	}
+};
\ No newline at end of file
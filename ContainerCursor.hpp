@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "ChainCodeReader.hpp"
+
+
+// Reader of little-endian numbers from a binary file (chain code container or feature store) that checks the bounds of every read.
+class ContainerCursor {
+private:
+	std::string_view data;	// Contents of the file.
+	size_t position = 0;	// Current offset.
+	ParseError& error;		// First error.
+
+public:
+	ContainerCursor(const std::string_view data, const size_t position, ParseError& error) :
+		data(data),
+		position(position),
+		error(error)
+	{}
+
+	// Current offset.
+	size_t offset() const {
+		return position;
+	}
+
+	// Setting the error at the current offset (always returns false).
+	bool fail(const std::string& message) {
+		error.offset = position;
+		error.message = message;
+		return false;
+	}
+
+	// Reading raw bytes.
+	bool bytes(const size_t size, std::string_view& result, const char* name) {
+		if (position > data.size() || data.size() - position < size) {
+			return fail(std::string("unexpected end of the container in the ") + name);
+		}
+
+		result = data.substr(position, size);
+		position += size;
+
+		return true;
+	}
+
+	// Reading a little-endian unsigned number with the given number of bytes.
+	bool number(const size_t size, uint64_t& result, const char* name) {
+		std::string_view value;
+		if (!bytes(size, value, name)) {
+			return false;
+		}
+
+		result = 0;
+		for (size_t i = 0; i < size; i++) {
+			result |= static_cast<uint64_t>(static_cast<uint8_t>(value[i])) << (8 * i);
+		}
+
+		return true;
+	}
+};
\ No newline at end of file
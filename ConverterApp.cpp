@@ -0,0 +1,68 @@
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "BatchCategorization.hpp"
+#include "ChainCodeContainerWriter.hpp"
+#include "ChainCodeReader.hpp"
+#include "MappedFile.hpp"
+
+
+/// <summary>
+/// Conversion of all text chain code files (*.txt) in a directory into a binary chain code container.
+/// Usage: ObjectCategorizationConverter <input directory> <output container>
+/// </summary>
+int main(int argc, char* argv[]) {
+	// Without an input directory and an output file, we only print the usage.
+	if (argc < 3) {
+		std::cerr << "Usage: " << argv[0] << " <input directory> <output container>\n";
+		return 1;
+	}
+
+	const std::string inputDirectory = argv[1];
+	const std::string outputFile = argv[2];
+
+	const std::vector<std::string> files = listChainCodeFiles(inputDirectory);
+	if (files.empty()) {
+		std::cerr << "No chain code files found in " << inputDirectory << ".\n";
+		return 1;
+	}
+
+	ChainCodeContainerWriter writer;
+	if (!writer.open(outputFile)) {
+		std::cerr << "Container " << outputFile << " could not be created.\n";
+		return 1;
+	}
+
+	// Adding the objects one by one (files that cannot be parsed are skipped).
+	uint failures = 0;
+	std::vector<ChainCodeRecord> records;
+	for (const std::string& file : files) {
+		const MappedFile mappedFile(file);
+		ParseError error;
+		if (!mappedFile.isOpen()) {
+			error.message = "file cannot be opened";
+		}
+
+		if (!mappedFile.isOpen() || !parseChainCodeRecords(mappedFile.text(), records, error)) {
+			std::cerr << file << ": FAILED (" << error.toString() << ")\n";
+			failures++;
+			continue;
+		}
+
+		if (!writer.add(std::filesystem::path(file).stem().string(), records)) {
+			std::cerr << "Object " << file << " could not be written.\n";
+			return 1;
+		}
+	}
+
+	if (!writer.close()) {
+		std::cerr << "Container " << outputFile << " could not be written.\n";
+		return 1;
+	}
+
+	std::cout << "Objects: " << files.size() - failures << "/" << files.size() << "\n";
+
+	return failures == 0 ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,148 @@
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define FEATURE_MATCHER_SSE2
+#endif
+
+#include "FeatureMatcher.hpp"
+
+
+// PRIVATE HELPER METHODS
+// Appending a reference with the given chain lengths.
+void FeatureMatcher::append(const std::string_view label, const size_t length, const auto& chainLengths) {
+	const uint lane = static_cast<uint>(lengths.size() % MATCH_BLOCK_SIZE);
+
+	// If the last block is full, a new block is started at the end of the values.
+	if (lane == 0) {
+		blockOffsets.push_back(values.size());
+		blockColumns.push_back(0);
+	}
+
+	// Since each block is stored column by column, adding columns to the last block only appends values.
+	uint& columns = blockColumns.back();
+	if (length > columns) {
+		columns = static_cast<uint>(length);
+		values.resize(blockOffsets.back() + static_cast<size_t>(columns) * MATCH_BLOCK_SIZE, 0.0f);
+	}
+
+	float* block = values.data() + blockOffsets.back();
+	for (size_t i = 0; i < length; i++) {
+		block[i * MATCH_BLOCK_SIZE + lane] = static_cast<float>(chainLengths[i]);
+	}
+
+	// The exact values are kept for the comparisons close to the tolerance.
+	exactOffsets.push_back(exactValues.size());
+	for (size_t i = 0; i < length; i++) {
+		exactValues.push_back(static_cast<double>(chainLengths[i]));
+	}
+
+	lengths.push_back(static_cast<uint>(length));
+	labels.emplace_back(label);
+}
+
+// Number of chain lengths of a reference that must match the query (or -1 if the reference cannot match).
+int32_t FeatureMatcher::requiredLength(const size_t queryLength, const size_t prefixLength, const size_t referenceLength) {
+	const size_t length = (queryLength == MATCH_COMPLETE_LENGTH || referenceLength == MATCH_COMPLETE_LENGTH) ? std::min(queryLength, referenceLength) : prefixLength;
+
+	// If the reference is shorter than the compared prefix, it cannot match.
+	return length <= referenceLength ? static_cast<int32_t>(length) : -1;
+}
+
+// Comparison of the required chain lengths of a reference with the query in double.
+bool FeatureMatcher::isExactMatch(const size_t reference, const std::vector<double>& query, const int32_t required) const {
+	// If the reference cannot match, there is nothing to compare.
+	if (required < 0) {
+		return false;
+	}
+
+	const double* referenceValues = exactValues.data() + exactOffsets[reference];
+	for (int32_t i = 0; i < required; i++) {
+		if (std::abs(referenceValues[i] - query[i]) > MATCH_TOLERANCE) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+
+// PUBLIC METHODS
+FeatureMatcher::FeatureMatcher(const FeatureStore& store) {
+	for (uint i = 0; i < store.size(); i++) {
+		add(store.label(i), store.values(i));
+	}
+}
+
+void FeatureMatcher::add(const std::string_view label, const std::span<const float> chainLengths) {
+	append(label, chainLengths.size(), chainLengths);
+}
+
+void FeatureMatcher::add(const std::string_view label, const FeatureVector& featureVector) {
+	append(label, featureVector.chainLengths.size(), featureVector.chainLengths);
+}
+
+uint FeatureMatcher::size() const {
+	return static_cast<uint>(lengths.size());
+}
+
+std::vector<std::string_view> FeatureMatcher::match(const FeatureVector& query) const {
+	std::vector<std::string_view> matches;
+
+	const size_t queryLength = query.chainLengths.size();
+	const size_t prefixLength = static_cast<size_t>(std::round(MATCH_PREFIX_RATIO * queryLength));
+#ifdef FEATURE_MATCHER_SSE2
+	const std::vector<float> queryValues(query.chainLengths.begin(), query.chainLengths.end());
+#endif
+
+	for (size_t block = 0; block < blockOffsets.size(); block++) {
+		// Number of chain lengths that must match for each reference of the block (-1 for rejected or empty lanes).
+		alignas(16) int32_t required[MATCH_BLOCK_SIZE];
+		for (uint lane = 0; lane < MATCH_BLOCK_SIZE; lane++) {
+			const size_t reference = block * MATCH_BLOCK_SIZE + lane;
+			required[lane] = reference < lengths.size() ? requiredLength(queryLength, prefixLength, lengths[reference]) : -1;
+		}
+
+#ifdef FEATURE_MATCHER_SSE2
+		// Comparing all four references at once, until all of them fail or all required chain lengths are compared.
+		// A reference fails only if a difference exceeds the tolerance by more than the rounding margin. If a difference
+		// is within the margin around the tolerance, the reference is marked to be compared again in double.
+		const float* blockValues = values.data() + blockOffsets[block];
+		const int32_t columns = *std::max_element(required, required + MATCH_BLOCK_SIZE);
+		const __m128i requiredLengths = _mm_load_si128(reinterpret_cast<const __m128i*>(required));
+		const __m128 absoluteMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+		const __m128 upperTolerance = _mm_set1_ps(static_cast<float>(MATCH_TOLERANCE + MATCH_FLOAT_MARGIN));
+		const __m128 lowerTolerance = _mm_set1_ps(static_cast<float>(MATCH_TOLERANCE - MATCH_FLOAT_MARGIN));
+		__m128i alive = _mm_cmpgt_epi32(requiredLengths, _mm_set1_epi32(-1));
+		__m128i uncertain = _mm_setzero_si128();
+		for (int32_t i = 0; i < columns && _mm_movemask_epi8(alive) != 0; i++) {
+			const __m128 difference = _mm_and_ps(_mm_sub_ps(_mm_loadu_ps(blockValues + static_cast<size_t>(i) * MATCH_BLOCK_SIZE), _mm_set1_ps(queryValues[i])), absoluteMask);
+			const __m128i compared = _mm_cmpgt_epi32(requiredLengths, _mm_set1_epi32(i));
+			const __m128i failed = _mm_and_si128(_mm_castps_si128(_mm_cmpgt_ps(difference, upperTolerance)), compared);
+			uncertain = _mm_or_si128(uncertain, _mm_and_si128(_mm_castps_si128(_mm_cmpgt_ps(difference, lowerTolerance)), compared));
+			alive = _mm_andnot_si128(failed, alive);
+		}
+
+		const int aliveLanes = _mm_movemask_ps(_mm_castsi128_ps(alive));
+		const int uncertainLanes = _mm_movemask_ps(_mm_castsi128_ps(uncertain));
+		for (uint lane = 0; lane < MATCH_BLOCK_SIZE; lane++) {
+			const size_t reference = block * MATCH_BLOCK_SIZE + lane;
+			if (((aliveLanes >> lane) & 1) && (((uncertainLanes >> lane) & 1) == 0 || isExactMatch(reference, query.chainLengths, required[lane]))) {
+				matches.push_back(labels[reference]);
+			}
+		}
+#else
+		// Comparing the references one by one in double, until the first chain length that fails.
+		for (uint lane = 0; lane < MATCH_BLOCK_SIZE; lane++) {
+			const size_t reference = block * MATCH_BLOCK_SIZE + lane;
+			if (isExactMatch(reference, query.chainLengths, required[lane])) {
+				matches.push_back(labels[reference]);
+			}
+		}
+#endif
+	}
+
+	return matches;
+}
\ No newline at end of file
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Constants.hpp"
+#include "FeatureStore.hpp"
+#include "FeatureVector.hpp"
+
+
+// CONSTANTS
+const double MATCH_TOLERANCE = 0.1;		  // Largest allowed difference between two chain lengths of matching objects.
+const double MATCH_PREFIX_RATIO = 0.7;	  // Share of the chain lengths of the query that have to match.
+const uint MATCH_COMPLETE_LENGTH = 12;	  // Feature vectors with this many values are compared completely.
+const uint MATCH_BLOCK_SIZE = 4;		  // Number of references that are compared at once.
+const double MATCH_FLOAT_MARGIN = 1e-6;	  // Bound of the rounding error of a difference of two chain lengths (0-1) in float.
+
+
+/// <summary>
+/// Comparison of one feature vector against many reference feature vectors with the same rule as the
+/// object comparison in the GUI: the first round(0.7 * query length) chain lengths (or all common chain lengths
+/// if one of the feature vectors has 12 values) must differ by at most 0.1.
+/// References are stored in blocks of four, each block column by column, so one block is compared with a single
+/// SIMD instruction per chain length and is abandoned as soon as all of its references fail.
+/// The float comparison only decides the differences that are clearly inside or outside of the tolerance. If a difference
+/// is within the rounding margin of the tolerance, the reference is compared again in double.
+/// </summary>
+class FeatureMatcher {
+private:
+	std::vector<float> values;			   // Chain lengths of all blocks (value i of lane j at block offset + i * 4 + j).
+	std::vector<size_t> blockOffsets;	   // Offset of each block in the values.
+	std::vector<uint> blockColumns;		   // Number of chain lengths stored for each block.
+	std::vector<uint> lengths;			   // Number of chain lengths of each reference.
+	std::vector<std::string> labels;	   // Label of each reference.
+	std::vector<double> exactValues;	   // Chain lengths of all references in double (reference by reference).
+	std::vector<size_t> exactOffsets;	   // Offset of each reference in the exact values.
+
+	// Appending a reference with the given chain lengths.
+	void append(const std::string_view label, const size_t length, const auto& chainLengths);
+
+	// Number of chain lengths of a reference that must match the query (or -1 if the reference cannot match).
+	static int32_t requiredLength(const size_t queryLength, const size_t prefixLength, const size_t referenceLength);
+
+	// Comparison of the required chain lengths of a reference with the query in double.
+	bool isExactMatch(const size_t reference, const std::vector<double>& query, const int32_t required) const;
+
+public:
+	/// <summary>
+	/// Default constructor of a matcher without references.
+	/// </summary>
+	FeatureMatcher() = default;
+
+	/// <summary>
+	/// Constructor of a matcher with all objects of a feature store as references.
+	/// </summary>
+	/// <param name="store">: feature store with the references</param>
+	FeatureMatcher(const FeatureStore& store);
+
+	/// <summary>
+	/// Adding a reference feature vector.
+	/// </summary>
+	/// <param name="label">: label of the reference</param>
+	/// <param name="chainLengths">: chain lengths of the reference</param>
+	void add(const std::string_view label, const std::span<const float> chainLengths);
+
+	/// <summary>
+	/// Adding a reference feature vector.
+	/// </summary>
+	/// <param name="label">: label of the reference</param>
+	/// <param name="featureVector">: feature vector of the reference</param>
+	void add(const std::string_view label, const FeatureVector& featureVector);
+
+	/// <summary>
+	/// Number of references.
+	/// </summary>
+	/// <returns>number of references</returns>
+	uint size() const;
+
+	/// <summary>
+	/// Comparison of a feature vector against all references.
+	/// </summary>
+	/// <param name="query">: feature vector that is compared</param>
+	/// <returns>labels of all matching references (in the order they were added)</returns>
+	std::vector<std::string_view> match(const FeatureVector& query) const;
+};
\ No newline at end of file
@@ -0,0 +1,146 @@
+#include <bit>
+#include <filesystem>
+
+#include "ContainerCursor.hpp"
+#include "FeatureStore.hpp"
+
+
+// PRIVATE HELPER METHODS
+// Little-endian number in the index entry of an object.
+uint64_t FeatureStore::entryNumber(const uint index, const size_t fieldOffset, const size_t size) const {
+	uint64_t value = 0;
+	const size_t entry = indexOffset + FEATURE_STORE_ENTRY_SIZE * static_cast<size_t>(index) + fieldOffset;
+	for (size_t i = 0; i < size; i++) {
+		value |= static_cast<uint64_t>(static_cast<uint8_t>(data[entry + i])) << (8 * i);
+	}
+
+	return value;
+}
+
+
+
+// PUBLIC METHODS
+bool FeatureStore::open(const std::string& path, ParseError& error) {
+	file = std::make_unique<MappedFile>(path);
+	data = std::string_view();
+	indexOffset = 0;
+	objectCount = 0;
+	storeFingerprint = FeatureStoreFingerprint();
+
+	// The values are read in place, so they have to be stored in the byte order of the machine.
+	if constexpr (std::endian::native != std::endian::little) {
+		error.offset = 0;
+		error.message = "feature stores can only be read on little-endian machines";
+		return false;
+	}
+
+	// If the file cannot be opened, we do not panic but abort the process.
+	if (!file->isOpen()) {
+		error.offset = 0;
+		error.message = "file " + path + " cannot be opened";
+		return false;
+	}
+	const std::string_view contents = file->text();
+
+	// Checking the header.
+	ContainerCursor header(contents, 0, error);
+	std::string_view magic;
+	uint64_t version = 0;
+	if (!header.bytes(FEATURE_STORE_MAGIC.size(), magic, "header")) {
+		return false;
+	}
+	if (magic != FEATURE_STORE_MAGIC) {
+		return ContainerCursor(contents, 0, error).fail("not a feature store");
+	}
+	if (!header.number(4, version, "header")) {
+		return false;
+	}
+	if (version != FEATURE_STORE_VERSION) {
+		return ContainerCursor(contents, 4, error).fail("unsupported feature store version " + std::to_string(version));
+	}
+
+	// Checking the footer.
+	if (contents.size() < FEATURE_STORE_HEADER_SIZE + FEATURE_STORE_FOOTER_SIZE) {
+		return header.fail("missing footer");
+	}
+
+	const size_t footerOffset = contents.size() - FEATURE_STORE_FOOTER_SIZE;
+	ContainerCursor footer(contents, footerOffset, error);
+	uint64_t index = 0;
+	uint64_t count = 0;
+	std::string_view indexMagic;
+	if (!footer.number(8, index, "footer") || !footer.number(4, count, "footer") || !footer.bytes(FEATURE_STORE_INDEX_MAGIC.size(), indexMagic, "footer")) {
+		return false;
+	}
+	if (indexMagic != FEATURE_STORE_INDEX_MAGIC) {
+		return ContainerCursor(contents, footerOffset + 12, error).fail("missing footer");
+	}
+	if (index < FEATURE_STORE_HEADER_SIZE || index > footerOffset || (footerOffset - index) != FEATURE_STORE_ENTRY_SIZE * count) {
+		return ContainerCursor(contents, footerOffset, error).fail("invalid index");
+	}
+
+	// Checking the entries once, so the accessors can read the values and labels without any checks.
+	// The values must be aligned, since they are read in place as floats.
+	for (uint64_t i = 0; i < count; i++) {
+		ContainerCursor entry(contents, static_cast<size_t>(index + FEATURE_STORE_ENTRY_SIZE * i), error);
+		uint64_t valuesOffset = 0;
+		uint64_t valueCount = 0;
+		uint64_t labelOffset = 0;
+		uint64_t labelLength = 0;
+		if (!entry.number(8, valuesOffset, "index") || !entry.number(4, valueCount, "index") || !entry.number(8, labelOffset, "index") || !entry.number(2, labelLength, "index")) {
+			return false;
+		}
+		if (valuesOffset < FEATURE_STORE_HEADER_SIZE || valuesOffset % alignof(float) != 0 || valuesOffset > index || (index - valuesOffset) / sizeof(float) < valueCount) {
+			return ContainerCursor(contents, static_cast<size_t>(index + FEATURE_STORE_ENTRY_SIZE * i), error).fail("invalid values of object " + std::to_string(i));
+		}
+		if (labelOffset < FEATURE_STORE_HEADER_SIZE || labelOffset > index || index - labelOffset < labelLength) {
+			return ContainerCursor(contents, static_cast<size_t>(index + FEATURE_STORE_ENTRY_SIZE * i), error).fail("invalid label of object " + std::to_string(i));
+		}
+	}
+
+	data = contents;
+	indexOffset = static_cast<size_t>(index);
+	objectCount = static_cast<uint>(count);
+
+	std::error_code fileError;
+	storeFingerprint.fileSize = contents.size();
+	storeFingerprint.modificationTime = static_cast<int64_t>(std::filesystem::last_write_time(path, fileError).time_since_epoch().count());
+
+	return true;
+}
+
+uint FeatureStore::size() const {
+	return objectCount;
+}
+
+FeatureStoreFingerprint FeatureStore::fingerprint() const {
+	return storeFingerprint;
+}
+
+std::string_view FeatureStore::label(const uint index) const {
+	// If the object does not exist, it has no label.
+	if (index >= objectCount) {
+		return std::string_view();
+	}
+
+	return data.substr(static_cast<size_t>(entryNumber(index, 12, 8)), static_cast<size_t>(entryNumber(index, 20, 2)));
+}
+
+std::span<const float> FeatureStore::values(const uint index) const {
+	// If the object does not exist, it has no values.
+	if (index >= objectCount) {
+		return std::span<const float>();
+	}
+
+	const float* values = reinterpret_cast<const float*>(data.data() + entryNumber(index, 0, 8));
+	return std::span<const float>(values, static_cast<size_t>(entryNumber(index, 8, 4)));
+}
+
+FeatureVector FeatureStore::featureVector(const uint index) const {
+	FeatureVector featureVector;
+
+	const std::span<const float> objectValues = values(index);
+	featureVector.chainLengths.assign(objectValues.begin(), objectValues.end());
+
+	return featureVector;
+}
\ No newline at end of file
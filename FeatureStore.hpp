@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+
+#include "ChainCodeReader.hpp"
+#include "Constants.hpp"
+#include "FeatureVector.hpp"
+#include "MappedFile.hpp"
+
+
+// CONSTANTS
+// Layout of a feature store (all numbers are little-endian):
+//   header:  magic "FVS1", uint32 version
+//   values:  float32 chain lengths of all objects, one contiguous array per object
+//   labels:  labels of all objects (without separators)
+//   index:   uint64 offset of the values, uint32 value count, uint64 offset of the label and uint16 label length of each object
+//   footer:  uint64 offset of the index, uint32 object count, magic "FVSI"
+const std::string_view FEATURE_STORE_MAGIC = "FVS1";		 // Magic number at the beginning of a feature store.
+const std::string_view FEATURE_STORE_INDEX_MAGIC = "FVSI";	 // Magic number at the end of a feature store.
+const uint32_t FEATURE_STORE_VERSION = 1;					 // Version of the feature store layout.
+const size_t FEATURE_STORE_HEADER_SIZE = 8;					 // Size of the header in bytes.
+const size_t FEATURE_STORE_ENTRY_SIZE = 22;					 // Size of an index entry in bytes.
+const size_t FEATURE_STORE_FOOTER_SIZE = 16;				 // Size of the footer in bytes.
+
+
+/// <summary>
+/// Fingerprint of a feature store file, so data derived from the store (e.g. a vantage-point tree) can detect
+/// that the store was rewritten since.
+/// </summary>
+struct FeatureStoreFingerprint {
+	uint64_t fileSize = 0;			// Size of the file in bytes.
+	int64_t modificationTime = 0;	// Time of the last modification of the file (in ticks of the file clock).
+
+	bool operator==(const FeatureStoreFingerprint& other) const = default;
+};
+
+
+/// <summary>
+/// Read-only binary library of labelled feature vectors. The store is memory-mapped once and the values of
+/// every object are read in place (without copying or parsing), so loading does not depend on the number of objects.
+/// </summary>
+class FeatureStore {
+private:
+	std::unique_ptr<MappedFile> file;  // Mapped feature store file.
+	std::string_view data;			   // Contents of the feature store.
+	size_t indexOffset = 0;			   // Offset of the index of objects.
+	uint objectCount = 0;			   // Number of objects in the feature store.
+	FeatureStoreFingerprint storeFingerprint;  // Fingerprint of the feature store file.
+
+	// Little-endian number in the index entry of an object.
+	uint64_t entryNumber(const uint index, const size_t fieldOffset, const size_t size) const;
+
+public:
+	/// <summary>
+	/// Opening a feature store file and checking its header and index.
+	/// </summary>
+	/// <param name="path">: path to the feature store file</param>
+	/// <param name="error">: description of the error (output)</param>
+	/// <returns>true if success, false otherwise</returns>
+	bool open(const std::string& path, ParseError& error);
+
+	/// <summary>
+	/// Number of objects in the feature store.
+	/// </summary>
+	/// <returns>number of objects</returns>
+	uint size() const;
+
+	/// <summary>
+	/// Fingerprint of the feature store file (taken when it was opened).
+	/// </summary>
+	/// <returns>fingerprint of the file</returns>
+	FeatureStoreFingerprint fingerprint() const;
+
+	/// <summary>
+	/// Label of an object.
+	/// </summary>
+	/// <param name="index">: index of the object</param>
+	/// <returns>label of the object (points into the mapped file, empty if the object does not exist)</returns>
+	std::string_view label(const uint index) const;
+
+	/// <summary>
+	/// Chain lengths of an object.
+	/// </summary>
+	/// <param name="index">: index of the object</param>
+	/// <returns>chain lengths of the object (point into the mapped file, empty if the object does not exist)</returns>
+	std::span<const float> values(const uint index) const;
+
+	/// <summary>
+	/// Feature vector of an object (a copy of its chain lengths).
+	/// </summary>
+	/// <param name="index">: index of the object</param>
+	/// <returns>feature vector of the object</returns>
+	FeatureVector featureVector(const uint index) const;
+};
\ No newline at end of file
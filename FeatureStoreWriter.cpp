@@ -0,0 +1,88 @@
+#include <bit>
+#include <limits>
+
+#include "FeatureStoreWriter.hpp"
+
+
+// PRIVATE HELPER METHODS
+// Writing raw bytes to the feature store.
+void FeatureStoreWriter::write(const void* bytes, const size_t size) {
+	out.write(static_cast<const char*>(bytes), static_cast<std::streamsize>(size));
+	position += size;
+}
+
+// Writing a little-endian unsigned number with the given number of bytes.
+void FeatureStoreWriter::writeNumber(const uint64_t value, const size_t size) {
+	uint8_t bytes[8];
+	for (size_t i = 0; i < size; i++) {
+		bytes[i] = static_cast<uint8_t>(value >> (8 * i));
+	}
+
+	write(bytes, size);
+}
+
+
+
+// PUBLIC METHODS
+bool FeatureStoreWriter::open(const std::string& path) {
+	out = std::ofstream(path, std::ios::binary | std::ios::trunc);
+	offsets.clear();
+	valueCounts.clear();
+	labelEnds.clear();
+	labels.clear();
+	position = 0;
+
+	// If a file is not open, we do not panic but abort the process.
+	if (!out.is_open()) {
+		return false;
+	}
+
+	write(FEATURE_STORE_MAGIC.data(), FEATURE_STORE_MAGIC.size());
+	writeNumber(FEATURE_STORE_VERSION, 4);
+
+	return static_cast<bool>(out);
+}
+
+bool FeatureStoreWriter::add(const std::string_view label, const FeatureVector& featureVector) {
+	// If the object does not fit into the layout, it is not written.
+	if (!out.is_open() || label.size() > std::numeric_limits<uint16_t>::max() || featureVector.chainLengths.size() > std::numeric_limits<uint32_t>::max()) {
+		return false;
+	}
+
+	offsets.push_back(position);
+	valueCounts.push_back(static_cast<uint32_t>(featureVector.chainLengths.size()));
+	labels.append(label);
+	labelEnds.push_back(labels.size());
+
+	for (const double chainLength : featureVector.chainLengths) {
+		writeNumber(std::bit_cast<uint32_t>(static_cast<float>(chainLength)), 4);
+	}
+
+	return static_cast<bool>(out);
+}
+
+bool FeatureStoreWriter::close() {
+	if (!out.is_open()) {
+		return false;
+	}
+
+	// Writing the labels, the index and the footer.
+	const uint64_t labelsOffset = position;
+	write(labels.data(), labels.size());
+
+	const uint64_t indexOffset = position;
+	for (size_t i = 0; i < offsets.size(); i++) {
+		const size_t labelStart = i == 0 ? 0 : labelEnds[i - 1];
+		writeNumber(offsets[i], 8);
+		writeNumber(valueCounts[i], 4);
+		writeNumber(labelsOffset + labelStart, 8);
+		writeNumber(labelEnds[i] - labelStart, 2);
+	}
+	writeNumber(indexOffset, 8);
+	writeNumber(offsets.size(), 4);
+	write(FEATURE_STORE_INDEX_MAGIC.data(), FEATURE_STORE_INDEX_MAGIC.size());
+
+	out.close();
+
+	return !out.fail();
+}
\ No newline at end of file
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "FeatureStore.hpp"
+#include "FeatureVector.hpp"
+
+
+/// <summary>
+/// Writer of a binary feature store (see FeatureStore for the layout). The values of each added object are
+/// written immediately, the labels and the index are written when the store is closed.
+/// </summary>
+class FeatureStoreWriter {
+private:
+	std::ofstream out;					// Output stream of the feature store.
+	std::vector<uint64_t> offsets;		// Offsets of the values of the added objects.
+	std::vector<uint32_t> valueCounts;	// Number of values of the added objects.
+	std::vector<size_t> labelEnds;		// End of the label of each added object in the labels.
+	std::string labels;					// Labels of the added objects.
+	uint64_t position = 0;				// Current offset in the feature store.
+
+	// Writing raw bytes to the feature store.
+	void write(const void* bytes, const size_t size);
+
+	// Writing a little-endian unsigned number with the given number of bytes.
+	void writeNumber(const uint64_t value, const size_t size);
+
+public:
+	/// <summary>
+	/// Creating a feature store file and writing its header.
+	/// </summary>
+	/// <param name="path">: path to the feature store file</param>
+	/// <returns>true if success, false otherwise</returns>
+	bool open(const std::string& path);
+
+	/// <summary>
+	/// Adding an object to the feature store (the chain lengths are stored as floats).
+	/// </summary>
+	/// <param name="label">: label of the object (at most 65535 bytes)</param>
+	/// <param name="featureVector">: feature vector of the object</param>
+	/// <returns>true if success, false otherwise</returns>
+	bool add(const std::string_view label, const FeatureVector& featureVector);
+
+	/// <summary>
+	/// Writing the labels, the index and the footer and closing the feature store.
+	/// </summary>
+	/// <returns>true if success, false otherwise</returns>
+	bool close();
+};
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include <fstream>
+#include <iterator>
 
 #include "FeatureVector.hpp"
 
@@ -21,7 +22,7 @@ FeatureVector::FeatureVector(const std::vector<std::pair<double, double>>& dista
 }
 
 
-bool FeatureVector::writeToFile(const std::string& fileName, const std::string& path) {
+bool FeatureVector::writeToFile(const std::string& fileName, const std::string& path) const {
 	std::ofstream out(path + fileName);
 
 	// If the file is not open, we return no success.
@@ -38,5 +39,22 @@ bool FeatureVector::writeToFile(const std::string& fileName, const std::string&
 		out << chainLengths[i] << /*":" << chainFarthestPoints[i] <<*/ " ";
 	}
 
+	return true;
+}
+
+bool FeatureVector::readFromFile(const std::string& file) {
+	std::ifstream in(file);
+
+	// If the file is not open, we return no success.
+	if (!in.is_open()) {
+		return false;
+	}
+
+	// Skipping the number of chains and reading each chain length.
+	std::string chainCount;
+	std::getline(in, chainCount);
+	chainLengths = std::vector<double>((std::istream_iterator<double>(in)), std::istream_iterator<double>());
+	chainFarthestPoints.clear();
+
 	return true;
 }
\ No newline at end of file
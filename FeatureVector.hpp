@@ -15,6 +15,11 @@ struct FeatureVector {
 	std::vector<double> chainFarthestPoints;  // Vector of chain lengths.
 
 
+	/// <summary>
+	/// Default constructor of an empty feature vector.
+	/// </summary>
+	FeatureVector() = default;
+
 	/// <summary>
 	/// Constructor of the feature vector.
 	/// </summary>
@@ -33,5 +38,12 @@ struct FeatureVector {
 	/// <param name="fileName">: desired name of the created file</param>
 	/// <param name="path">: path on the drive where the created file should be stored</param>
 	/// <returns>true if success, false otherwise</returns>
-	bool writeToFile(const std::string& fileName, const std::string& path);
+	bool writeToFile(const std::string& fileName, const std::string& path) const;
+
+	/// <summary>
+	/// Input of the chain lengths from a file written by writeToFile.
+	/// </summary>
+	/// <param name="file">: path to the file</param>
+	/// <returns>true if success, false otherwise</returns>
+	bool readFromFile(const std::string& file);
 };
\ No newline at end of file
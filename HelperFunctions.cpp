@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <cstdlib>
 #include <numbers>
 
 #include "HelperFunctions.hpp"
@@ -136,228 +138,16 @@ Pixel getEndPointForBresenham(const Pixel& start, const double angle, const int
 	return Pixel();
 }
 
-std::vector<Pixel> bresenham(const Pixel& startPoint, const Pixel& endPoint, const PixelField& pixelField) {
-	std::vector<Pixel> pixels;
-	
-	// Calculating the difference between the both coordinates.
-	const int deltaX = endPoint.x - startPoint.x;
-	const int deltaY = endPoint.y - startPoint.y;
-	
-	// Getting the signs of both deltas.
-	const short signX = sign(deltaX);
-	const short signY = sign(deltaY);
-
-	// Helper values for coordinate calculation.
-	const int ax = 2 * std::abs(deltaX);
-	const int ay = 2 * std::abs(deltaY);
-	
-	// Starting X and Y coordinates.
-	int x = startPoint.x;
-	int y = startPoint.y;
-	int error;
-
-	if (ax >= ay) {
-		// Calculating the current error.
-		error = ay - (ax / 2);
-
-		for (int i = 0; i <= std::abs(deltaX); i++) {
-			// Adding the new pixel to the vector.
-			if (x >= 0 && x != pixelField.size() && y >= 0 && y != pixelField.size()) {
-				pixels.push_back(Pixel(x, y, pixelField[y][x].position, pixelField[y][x].directionPrevious, pixelField[y][x].directionNext));
-			}
-
-			// Adding the correct values to X and Y coordinates.
-			if (error >= 0) {
-				error -= ax;
-				y += signY;
-			}
-
-			error += ay;
-			x += signX;
-		}
-	}
-	else {
-		// Calculating the current error.
-		error = ax - (ay / 2);
-
-		for (int i = 0; i <= std::abs(deltaY); i++) {
-			// Adding the new pixel to the vector.
-			if (x != pixelField.size() && y != pixelField.size()) {
-				pixels.push_back(Pixel(x, y, pixelField[y][x].position, pixelField[y][x].directionPrevious, pixelField[y][x].directionNext));
-			}
-
-			// Adding the correct values to X and Y coordinates.
-			if (error > 0) {
-				error -= ay;
-				x += signX;
-			}
-
-			error += ax;
-			y += signY;
-		}
-	}
-
-	return pixels;
+std::vector<RasterPixel> bresenham(const Pixel& startPoint, const Pixel& endPoint, const PixelField& pixelField) {
+	return rasterizeLine<BresenhamTraversal>(startPoint, endPoint, pixelField);
 }
 
-std::vector<Pixel> clearyWyvill(const Pixel& startPoint, const Pixel& endPoint, const PixelField& pixelField, const double angleOfRotation) {
-	std::vector<Pixel> pixels;
-
-	short pX = -1;
-	short pY = -1;
-	if (endPoint.x > startPoint.x) {
-		pX = 1;
-	}
-	if (startPoint.y > startPoint.y) {
-		pY = 1;
-	}
-
-	// Calculation of delta X and delta Y distances.
-	double deltaX = std::abs(1 / std::sin(PI / 2 - angleOfRotation));
-	double deltaY = std::abs(1 / std::cos(PI / 2 - angleOfRotation));
-
-	double dX = deltaX;
-	double dY = deltaY;
-
-	Pixel currentPixel = startPoint;
-	pixels.push_back(Pixel(currentPixel));
-
-	while (
-		currentPixel != Pixel(endPoint.x - 1, endPoint.y - 1) &&
-		currentPixel != Pixel(endPoint.x, endPoint.y - 1) &&
-		currentPixel != Pixel(endPoint.x + 1, endPoint.y - 1) &&
-		currentPixel != Pixel(endPoint.x - 1, endPoint.y) &&
-		currentPixel != Pixel(endPoint.x, endPoint.y) &&
-		currentPixel != Pixel(endPoint.x + 1, endPoint.y) &&
-		currentPixel != Pixel(endPoint.x - 1, endPoint.y + 1) &&
-		currentPixel != Pixel(endPoint.x, endPoint.y + 1) &&
-		currentPixel != Pixel(endPoint.x + 1, endPoint.y + 1)
-	)
-	{
-		if (currentPixel.x >= static_cast<int>(pixelField.size()) || currentPixel.y >= static_cast<int>(pixelField.size())) {
-			break;
-		}
-
-		if (dX <= dY) {
-			currentPixel.x += pX;
-			dX += deltaX;
-			pixels.push_back(Pixel(currentPixel.x, currentPixel.y, pixelField[currentPixel.y][currentPixel.x].position, pixelField[currentPixel.y][currentPixel.x].directionPrevious, pixelField[currentPixel.y][currentPixel.x].directionNext));
-		}
-		else {
-			currentPixel.y += pY;
-			dY += deltaY;
-			pixels.push_back(Pixel(currentPixel.x, currentPixel.y, pixelField[currentPixel.y][currentPixel.x].position, pixelField[currentPixel.y][currentPixel.x].directionPrevious, pixelField[currentPixel.y][currentPixel.x].directionNext));
-		}
-	}
-	
-	return pixels;
+std::vector<RasterPixel> clearyWyvill(const Pixel& startPoint, const Pixel& endPoint, const PixelField& pixelField) {
+	return rasterizeLine<ClearyWyvillTraversal>(startPoint, endPoint, pixelField);
 }
 
-std::vector<Pixel> findEdgePixelsWithBresenham(Pixel startPoint, Pixel endPoint, const PixelField& pixelField) {
-	std::vector<Pixel> pixels;
-
-	if (startPoint.x > endPoint.x) {
-		Pixel temp = startPoint;
-		startPoint = endPoint;
-		endPoint = temp;
-	}
-
-	// Calculating the difference between the both coordinates.
-	const double deltaX = endPoint.x - startPoint.x;
-	const double deltaY = endPoint.y - startPoint.y;
-	const short signX = deltaX >= 0 ? 1 : -1;
-	const short signY = deltaY >= 0 ? 1 : -1;
-	double coefficient = deltaY / deltaX;
-
-	// Starting X and Y coordinates.
-	double x = startPoint.x;
-	double y = startPoint.y;
-	double error = deltaY / deltaX;
-
-	if (std::abs(deltaX) >= std::abs(deltaY)) {
-		// Calculating the current error.
-		error = deltaY / deltaX;
-
-		if (error > 0) {
-			for (int i = 0; i <= std::abs(deltaX); i++) {
-				// Adding the new pixel to the vector.
-				const int pixelY = static_cast<int>(y + (error - coefficient));
-				if (x >= 0 && x < pixelField.size() && pixelY >= 0 && pixelY < pixelField.size() && pixelField[pixelY][x].position == Position::edge) {
-					pixels.push_back(Pixel(x, y + (error - coefficient), pixelField[pixelY][x].position, pixelField[pixelY][x].directionPrevious, pixelField[pixelY][x].directionNext));
-				}
-
-				// Adding the correct values to X and Y coordinates.
-				if (error > 0.5) {
-					error -= 1;
-					y += 1;
-				}
-
-				error += coefficient;
-				x += signX;
-			}
-		}
-		else {
-			for (int i = 0; i <= std::abs(deltaX); i++) {
-				// Adding the new pixel to the vector.
-				const int pixelY = static_cast<int>(y + (error - coefficient));
-				if (x >= 0 && x < pixelField.size() && pixelY >= 0 && pixelY < pixelField.size() && pixelField[pixelY][x].position == Position::edge) {
-					pixels.push_back(Pixel(x, y + (error - coefficient), pixelField[pixelY][x].position, pixelField[pixelY][x].directionPrevious, pixelField[pixelY][x].directionNext));
-				}
-
-				// Adding the correct values to X and Y coordinates.
-				if (error < -0.5) {
-					error += 1;
-					y -= 1;
-				}
-
-				error += coefficient;
-				x += signX;
-			}
-		}
-	}
-	else {
-		// Calculating the current error.
-		error = deltaX / deltaY;
-
-		if (error > 0) {
-			for (int i = 0; i <= std::abs(deltaY); i++) {
-				// Adding the new pixel to the vector.
-				const int pixelX = static_cast<int>(x + (error - 1 / coefficient));
-				if (pixelX < pixelField.size() && y < pixelField.size() && pixelField[y][pixelX].position == Position::edge) {
-					pixels.push_back(Pixel(x + (error - 1 / coefficient), y, pixelField[y][pixelX].position, pixelField[y][pixelX].directionPrevious, pixelField[y][pixelX].directionNext));
-				}
-
-				// Adding the correct values to X and Y coordinates.
-				if (error > 0.5) {
-					error -= 1;
-					x += signX;
-				}
-
-				error += (1 / coefficient);
-				y += signY;
-			}
-		}
-		else {
-			for (int i = 0; i <= std::abs(deltaY); i++) {
-				// Adding the new pixel to the vector.
-				const int pixelX = static_cast<int>(x + (1 / coefficient - error));
-				if (pixelX < pixelField.size() && y < pixelField.size() && pixelField[y][pixelX].position == Position::edge) {
-					pixels.push_back(Pixel(x + (1 / coefficient - error), y, pixelField[y][pixelX].position, pixelField[y][pixelX].directionPrevious, pixelField[y][pixelX].directionNext));
-				}
-
-				// Adding the correct values to X and Y coordinates.
-				if (error > 0.5) {
-					error -= 1;
-					x += signX;
-				}
-
-				error += (1 / coefficient);
-				y += signY;
-			}
-		}
-	}
-
-	return pixels;
+std::vector<Pixel> findEdgePixelsWithBresenham(const Pixel& startPoint, const Pixel& endPoint, const PixelField& pixelField) {
+	return findEdgePixelsAlongLine<DdaTraversal>(startPoint, endPoint, pixelField);
 }
 
 
@@ -378,6 +168,18 @@ Pixel rotate2D(const Pixel& point, const Pixel& referencePoint, const double ang
 	return Pixel(newX, newY, point.position);
 }
 
+Pixel rotate2DSubPixel(const Pixel& point, const Pixel& referencePoint, const double angle) {
+	// Translating the point to reference point local coordinate system.
+	const double x = point.x - referencePoint.x;
+	const double y = point.y - referencePoint.y;
+
+	// Rotating the point and translating it back to the global coordinate system.
+	const double rotatedX = x * std::cos(angle) - y * std::sin(angle) + referencePoint.x;
+	const double rotatedY = x * std::sin(angle) + y * std::cos(angle) + referencePoint.y;
+
+	return Pixel(rotatedX, rotatedY, point.position, point.directionPrevious, point.directionNext);
+}
+
 std::vector<LineSegment> douglasPeucker(const std::vector<Pixel>& pixels, const LineSegment& lineSegment, const double epsilon) {
 	std::vector<LineSegment> lineSegments;
 
@@ -5,6 +5,8 @@
 #include "Constants.hpp"
 #include "LineSegment.hpp"
 #include "LineSweeping.hpp"
+#include "LineTraversal.hpp"
+#include "PixelField.hpp"
 
 
 // SIMPLE FUNCTIONS
@@ -67,32 +69,31 @@ double distance(const Pixel& p1, const Pixel& p2);
 Pixel getEndPointForBresenham(const Pixel& start, const double angle, const int maxCoordinate);
 
 /// <summary>
-/// Bresenham rasterization algorithm.
+/// Bresenham rasterization algorithm (see BresenhamTraversal).
 /// </summary>
 /// <param name="startPoint">: start pixel of the line segment</param>
 /// <param name="endPoint">: end pixel of the line segment</param>
 /// <param name="pixelField">: pixel field of the rasterized scene with an object</param>
 /// <returns>list of pixels of the rasterized line segment</returns>
-std::vector<Pixel> bresenham(const Pixel& startPoint, const Pixel& endPoint, const PixelField& pixelField);
+std::vector<RasterPixel> bresenham(const Pixel& startPoint, const Pixel& endPoint, const PixelField& pixelField);
 
 /// <summary>
-/// Cleary-Wyvill rasterization algorithm.
+/// Cleary-Wyvill rasterization algorithm (see ClearyWyvillTraversal).
 /// </summary>
 /// <param name="startPoint">: start pixel of the line segment</param>
 /// <param name="endPoint">: end pixel of the line segment</param>
 /// <param name="pixelField">: pixel field of the rasterized scene with an object</param>
-/// <param name="angleOfRotation">: angle of the line segment in radians</param>
 /// <returns>list of pixels of the rasterized line segment</returns>
-std::vector<Pixel> clearyWyvill(const Pixel& startPoint, const Pixel& endPoint, const PixelField& pixelField, const double angleOfRotation);
+std::vector<RasterPixel> clearyWyvill(const Pixel& startPoint, const Pixel& endPoint, const PixelField& pixelField);
 
 /// <summary>
-/// Edge pixel detection using Bresenham rasterization algorithm.
+/// Edge pixel detection along the line segment (integer DDA traversal, see DdaTraversal).
 /// </summary>
 /// <param name="startPoint">: start pixel of the line segment</param>
 /// <param name="endPoint">: end pixel of the line segment</param>
 /// <param name="pixelField">: pixel field of the rasterized scene with an object</param>
 /// <returns>list of edge pixels</returns>
-std::vector<Pixel> findEdgePixelsWithBresenham(Pixel startPoint, Pixel endPoint, const PixelField& pixelField);
+std::vector<Pixel> findEdgePixelsWithBresenham(const Pixel& startPoint, const Pixel& endPoint, const PixelField& pixelField);
 
 
 // ROTATION FUNCTIONS
@@ -105,6 +106,15 @@ std::vector<Pixel> findEdgePixelsWithBresenham(Pixel startPoint, Pixel endPoint,
 /// <returns>rotated pixel</returns>
 Pixel rotate2D(const Pixel& point, const Pixel& referencePoint, const double angle);
 
+/// <summary>
+/// Rotation of a point around the reference point for a certain angle (the sub-pixel coordinates are kept).
+/// </summary>
+/// <param name="point">: point to be rotated</param>
+/// <param name="referencePoint">: reference point for the rotation</param>
+/// <param name="angle">: angle of the rotation in radians</param>
+/// <returns>rotated point with the position and chain code directions of the original point</returns>
+Pixel rotate2DSubPixel(const Pixel& point, const Pixel& referencePoint, const double angle);
+
 
 
 // DOUGLAS-PEUCKER ALGORITHM
@@ -1,20 +1,24 @@
 #include <algorithm>
-#include <fstream>
+#include <cmath>
+#include <functional>
+#include <iterator>
 #include <limits>
 #include <stack>
+#include <string>
 
 #include "Chain.hpp"
 #include "ChainCode.hpp"
+#include "ChainCodeContainer.hpp"
+#include "ChainCodeDirection.hpp"
+#include "ChainCodeReader.hpp"
 #include "HelperFunctions.hpp"
 #include "LineSweeping.hpp"
-#include "stdafx.h"
 
 
 // PRIVATE HELPER METHODS
 // Transforming chain code to coordinates.
 void LineSweeping::calculateCoordinatesFromChainCode() {
-	// Current point and X and Y coordinates.
-	Pixel point;
+	// Current X and Y coordinates.
 	int currentX = 0;
 	int currentY = 0;
 
@@ -23,59 +27,37 @@ void LineSweeping::calculateCoordinatesFromChainCode() {
 		// Setting the start point.
 		currentX = chainCode.startPoint.x * chainCode.scale;
 		currentY = chainCode.startPoint.y * chainCode.scale;
-		point.x = currentX;
-		point.y = currentY;
-		point.directionNext = chainCode.code.front();
-		point.directionPrevious = (chainCode.code.back() + 4) % 8;
-		coordinates.push_back(point);
-
-		// Iterating through the chain code.
-		for (const short& chainElement : chainCode.code) {
-			const short direction = chainElement;  // Casting the byte to char.
-
-			// 0 means right.
-			if (direction == 0) {
-				currentX++;
-			}
-			// 1 means up and right.
-			else if (direction == 1) {
-				currentY++;
-				currentX++;
-			}
-			// 2 means up.
-			else if (direction == 2) {
-				currentY++;
-			}
-			// 3 means up and left.
-			else if (direction == 3) {
-				currentY++;
-				currentX--;
-			}
-			// 4 means left.
-			else if (direction == 4) {
-				currentX--;
-			}
-			// 5 means down and left.
-			else if (direction == 5) {
-				currentY--;
-				currentX--;
-			}
-			// 6 means down.
-			else if (direction == 6) {
-				currentY--;
-			}
-			// 7 means down and right.
-			else if (direction == 7) {
-				currentY--;
-				currentX++;
+		coordinates.push_back(RasterPixel(currentX, currentY, Position::edge, ChainCodeDirection::opposite(chainCode.back()), chainCode.front()));
+
+		coordinates.reserve(coordinates.size() + chainCode.size());
+
+		// Iterating through the runs of the chain code.
+		for (uint i = 0; i < chainCode.runs.size(); i++) {
+			const ChainCodeRun& run = chainCode.runs[i];
+			const short direction = run.direction;
+
+			// The direction after the run (the last coordinate is the start point, which is removed afterwards).
+			const short nextDirection = i + 1 < chainCode.runs.size() ? chainCode.runs[i + 1].direction : chainCode.front();
+
+			// Move of a single command.
+			const int moveX = ChainCodeDirection::moveX(direction);
+			const int moveY = ChainCodeDirection::moveY(direction);
+			const short directionPrevious = ChainCodeDirection::opposite(direction);
+
+			// Adding a new coordinate for each command of the run. Each coordinate is computed directly from
+			// the start of the run (a prefix sum of equal moves), so the loop has no dependence between iterations.
+			const size_t first = coordinates.size();
+			coordinates.resize(first + run.count);
+			RasterPixel* runCoordinates = coordinates.data() + first;
+			for (uint j = 0; j < run.count; j++) {
+				const int step = static_cast<int>(j) + 1;
+				runCoordinates[j] = RasterPixel(currentX + step * moveX, currentY + step * moveY, Position::edge, directionPrevious, direction);
 			}
+			currentX += static_cast<int>(run.count) * moveX;
+			currentY += static_cast<int>(run.count) * moveY;
 
-			// Adding a new coordinate to the vector.
-			point.x = currentX;
-			point.y = currentY;
-			point.directionPrevious = (coordinates.back().directionNext + 4) % 8;
-			point.directionNext = *(&chainElement + 1);
-			coordinates.push_back(point);
+			// The last coordinate of the run continues in the direction of the next run.
+			runCoordinates[run.count - 1] = RasterPixel(currentX, currentY, Position::edge, directionPrevious, nextDirection);
 		}
 
 		coordinates.pop_back();
@@ -124,8 +106,10 @@ void LineSweeping::calculateBoundingBox() {
 		coordinates.begin(),
 		coordinates.end(),
 		coordinates.begin(),
-		[&xMin, &yMin](Pixel point) {
-			return Pixel(point.x - xMin, point.y - yMin, Position::undefined, point.directionPrevious, point.directionNext);
+		[&xMin, &yMin](RasterPixel point) {
+			point.x -= xMin;
+			point.y -= yMin;
+			return point;
 		}
 	);
 
@@ -157,8 +141,10 @@ void LineSweeping::calculateBoundingBox() {
 		coordinates.begin(),
 		coordinates.end(),
 		coordinates.begin(),
-		[&magnifiedX, &magnifiedY](const Pixel& point) {
-			return Pixel(point.x + magnifiedX, point.y + magnifiedY, Position::undefined, point.directionPrevious, point.directionNext);
+		[&magnifiedX, &magnifiedY](RasterPixel point) {
+			point.x += magnifiedX;
+			point.y += magnifiedY;
+			return point;
 		}
 	);
 
@@ -175,77 +161,631 @@ void LineSweeping::calculateBoundingBox() {
 	}
 
 	// Creating the pixel field.
-	for (int y = 0; y < maxCoordinate; y++) {
-		pixelField.push_back(std::vector<Pixel>());
+	pixelField = PixelField(maxCoordinate);
+
+	for (const RasterPixel& coordinate : coordinates) {
+		pixelField.setEdge(coordinate.x, coordinate.y, coordinate.directionPrevious(), coordinate.directionNext());
+	}
+}
 
-		for (int x = 0; x < maxCoordinate; x++) {
-			pixelField[y].push_back(Pixel(x, y, Position::undefined));
+// Walking the chain codes of the shape and passing each span [from, to) between a pair of
+// stack-matched contour pixels to the toggle function (called with Y, from and to).
+// Contour pixels are already marked as edges in calculateBoundingBox, so spans never change them.
+template <typename ToggleSpan>
+void LineSweeping::forEachFillSpan(ToggleSpan toggleSpan) const {
+	// Creating two stacks for filling the shape.
+	std::stack<uint> leftStack;
+	std::stack<uint> rightStack;
+	long startCoordinate = 0;
+
+	// Iterating through the runs of the chain codes and filling the shape.
+	for (const ChainCode& chainCode : chainCodes) {
+		for (const ChainCodeRun& run : chainCode.runs) {
+			const short code = run.direction;
+			const bool up = code == 1 || code == 2 || code == 3;
+			const bool down = code == 5 || code == 6 || code == 7;
+
+			// Horizontal runs do not change the stacks, so they are skipped as a whole.
+			if (!up && !down) {
+				startCoordinate += run.count;
+				continue;
+			}
+
+			for (uint i = 0; i < run.count; i++) {
+				// Getting the X and Y coordinates of the pixel.
+				const uint x = coordinates[startCoordinate + i].x;
+				const uint y = coordinates[startCoordinate + i].y;
+
+				// If the instruction is to go up, the left stack is pushed to if the right stack is empty.
+				if (up) {
+					if (!rightStack.empty()) {
+						// Getting the top element from the right stack.
+						const uint right = rightStack.top();
+						rightStack.pop();
+
+						// The pixels between the left and right pixel coordinates (in any order) are toggled.
+						if (right > x) {
+							toggleSpan(y, x + 1, right);
+						}
+						else {
+							toggleSpan(y, right + 1, x);
+						}
+					}
+					else {
+						leftStack.push(x);
+						//fillRectangle(dc, x, y, 1, maxCoordinate, *wxRED_PEN, *wxRED_BRUSH, plotRatio);
+					}
+				}
+				// If the instruction is to go down, the right stack is pushed to if the left stack is empty.
+				else {
+					if (!leftStack.empty()) {
+						// Getting the top element from the left stack.
+						const uint left = leftStack.top();
+						leftStack.pop();
+
+						// The pixels between the left and right pixel coordinates (in any order) are toggled in the row below.
+						if (left < x) {
+							toggleSpan(y - 1, left + 1, x);
+						}
+						else {
+							toggleSpan(y - 1, x + 1, left);
+						}
+					}
+					else {
+						rightStack.push(x);
+						//fillRectangle(dc, x, y, 1, maxCoordinate, *wxBLUE_PEN, *wxBLUE_BRUSH, plotRatio);
+					}
+				}
+			}
+
+			startCoordinate += run.count;
 		}
+
+		leftStack = std::stack<uint>();
+		rightStack = std::stack<uint>();
 	}
+}
 
-	for (const Pixel& coordinate : coordinates) {
-		pixelField[coordinate.y][coordinate.x].position = Position::edge;
-		pixelField[coordinate.y][coordinate.x].directionPrevious = coordinate.directionPrevious;
-		pixelField[coordinate.y][coordinate.x].directionNext = coordinate.directionNext;
+// Filling the loaded shape with parity words (64 pixels per word).
+// A non-edge pixel ends up inside if it was inside before the fill and is toggled an even number of times
+// or if it was not inside and is toggled an odd number of times, which is the same as the pixel-by-pixel fill.
+void LineSweeping::fillShapeParityWords() {
+	const uint size = static_cast<uint>(pixelField.size());
+	const uint wordsPerRow = (size + 63) / 64;
+	std::vector<uint64_t> parity(static_cast<size_t>(wordsPerRow) * size, 0);
+
+	// Toggling the parity bits of each span.
+	forEachFillSpan([&parity, wordsPerRow](const uint y, const uint from, const uint to) {
+		toggleParityWords(&parity[static_cast<size_t>(y) * wordsPerRow], from, to);
+	});
+
+	// Setting the positions of all non-edge pixels in a single pass (undefined pixels become outside).
+	const uint8_t insideCell = PixelCell::pack(Position::inside);
+	const uint8_t outsideCell = PixelCell::pack(Position::outside);
+	for (uint y = 0; y < size; y++) {
+		const uint64_t* parityRow = &parity[static_cast<size_t>(y) * wordsPerRow];
+		uint8_t* cells = pixelField.row(y);
+
+		for (uint word = 0; word < wordsPerRow; word++) {
+			const uint64_t toggledBits = parityRow[word];
+			const uint begin = word * 64;
+			const uint end = std::min(begin + 64, size);
+
+			// If no pixel of the word is toggled, inside and edge pixels are kept and all other pixels become outside.
+			if (toggledBits == 0) {
+				for (uint x = begin; x < end; x++) {
+					const Position position = PixelCell::position(cells[x]);
+					cells[x] = position == Position::edge || position == Position::inside ? cells[x] : outsideCell;
+				}
+				continue;
+			}
+
+			for (uint x = begin; x < end; x++) {
+				const Position position = PixelCell::position(cells[x]);
+				const bool toggled = (toggledBits >> (x - begin)) & 1;
+				const uint8_t filledCell = toggled != (position == Position::inside) ? insideCell : outsideCell;
+				cells[x] = position == Position::edge ? cells[x] : filledCell;
+			}
+		}
 	}
 }
 
-// Filling a rectangle at X and Y coordinates.
-void LineSweeping::fillRectangle(wxDC& dc, const int x, const int y, const int pixelSize, const int maxCoordinate, const wxPen& pen, const wxBrush& brush, const double ratio) const {
-	// Creating a wxPoint for rendering.
-	wxPoint P[4] = {
-		wxPoint(static_cast<int>(x * ratio), static_cast<int>((maxCoordinate - y) * ratio)),
-		wxPoint(static_cast<int>(x * ratio + pixelSize), static_cast<int>((maxCoordinate - y) * ratio)),
-		wxPoint(static_cast<int>(x * ratio + pixelSize), static_cast<int>((maxCoordinate - y) * ratio + pixelSize)),
-		wxPoint(static_cast<int>(x * ratio), static_cast<int>((maxCoordinate - y) * ratio + pixelSize))
-	};
+// Toggling the parity bits of pixels [from, to) in a row of parity words.
+void LineSweeping::toggleParityWords(uint64_t* row, const uint from, const uint to) {
+	// If the span is empty, there is nothing to toggle.
+	if (from >= to) {
+		return;
+	}
 
-	// Drawing the point.
-	dc.SetPen(pen);
-	dc.SetBrush(brush);
-	dc.DrawPolygon(4, P);
+	const uint firstWord = from / 64;
+	const uint lastWord = (to - 1) / 64;
+	const uint64_t firstMask = ~uint64_t(0) << (from % 64);
+	const uint64_t lastMask = ~uint64_t(0) >> (63 - (to - 1) % 64);
 
-	// Resetting the pen and the brush.
-	dc.SetPen(*wxBLACK_PEN);
-	dc.SetBrush(*wxWHITE_BRUSH);
+	if (firstWord == lastWord) {
+		row[firstWord] ^= firstMask & lastMask;
+		return;
+	}
+
+	row[firstWord] ^= firstMask;
+	for (uint word = firstWord + 1; word < lastWord; word++) {
+		row[word] = ~row[word];
+	}
+	row[lastWord] ^= lastMask;
+}
+
+// Setting new chain codes and calculating the coordinates and the bounding box of the object.
+void LineSweeping::setChainCodes(std::vector<ChainCode>&& newChainCodes) {
+	// Clearing the previous coordinates.
+	chainCodes = std::move(newChainCodes);
+	coordinates.clear();
+	pixelField.clear();
+	chains.clear();
+
+	// Calculating the coordinates.
+	calculateCoordinatesFromChainCode();
+	calculateBoundingBox();
 }
 
 // Finding edge pixel pairs.
-std::vector<Pixel> LineSweeping::findEdgePixels(const std::vector<Pixel>& rasterizedLine) const {
+std::vector<Pixel> LineSweeping::findEdgePixels(const std::vector<RasterPixel>& rasterizedLine) const {
 	std::vector<Pixel> pixels;
 
 	for (uint i = 1; i < rasterizedLine.size(); i++) {
-		Pixel previousPixel = rasterizedLine[i - 1];
-		Pixel pixel = rasterizedLine[i];
+		appendEdgePixels(pixels, rasterizedLine[i - 1], rasterizedLine[i]);
+	}
 
-		if (previousPixel.position == Position::outside && pixel.position == Position::edge && (pixels.empty() || pixel != pixels.back())) {
-			pixels.emplace_back(pixel);
+	return pixels;
+}
+
+// Adding the edge pixels of a pair of neighbouring pixels on the rasterized line.
+void LineSweeping::appendEdgePixels(std::vector<Pixel>& pixels, const RasterPixel& previousPixel, const RasterPixel& pixel) const {
+	const Position previousPosition = previousPixel.position();
+	const Position position = pixel.position();
+
+	if (previousPosition == Position::outside && position == Position::edge && (pixels.empty() || Pixel(pixel) != pixels.back())) {
+		pixels.emplace_back(pixel);
+	}
+	if (previousPosition == Position::edge && position == Position::inside && (pixels.empty() || Pixel(previousPixel) != pixels.back())) {
+		pixels.emplace_back(previousPixel);
+	}
+	if (previousPosition == Position::inside && position == Position::edge && (pixels.empty() || Pixel(pixel) != pixels.back())) {
+		pixels.emplace_back(pixel);
+	}
+	if (previousPosition == Position::edge && position == Position::outside && (pixels.empty() || Pixel(previousPixel) != pixels.back())) {
+		pixels.emplace_back(previousPixel);
+	}
+}
+
+// Finding the edge pixels of all sweep lines. The lines are split into contiguous bands and each band is a task.
+template <typename LineEdgePixels>
+std::vector<std::vector<Pixel>> LineSweeping::findEdgePixelsInBands(const uint lineCount, const LineEdgePixels& lineEdgePixels) const {
+	std::vector<std::vector<Pixel>> edgePixels(lineCount);
+	const uint bandCount = std::min(sweepBandCount, std::max(lineCount, 1u));
+
+	for (uint band = 0; band < bandCount; band++) {
+		#pragma omp task firstprivate(band) shared(edgePixels, lineEdgePixels) if(bandCount > 1)
+		{
+			const uint firstLine = static_cast<uint>(static_cast<u128>(lineCount) * band / bandCount);
+			const uint lastLine = static_cast<uint>(static_cast<u128>(lineCount) * (band + 1) / bandCount);
+
+			for (uint line = firstLine; line < lastLine; line++) {
+				edgePixels[line] = lineEdgePixels(line);
+			}
 		}
-		if (pixelField[previousPixel.y][previousPixel.x].position == Position::edge && pixelField[pixel.y][pixel.x].position == Position::inside && (pixels.empty() || previousPixel != pixels.back())) {
-			pixels.emplace_back(previousPixel);
+	}
+	#pragma omp taskwait
+
+	return edgePixels;
+}
+
+// Edge pixel detection on the diagonal sweep lines from the given start points, traversed between their end points.
+template <typename Traversal>
+std::vector<std::vector<Pixel>> LineSweeping::findEdgePixelsOnLines(const std::vector<Pixel>& startPoints, const double angle) const {
+	return findEdgePixelsInBands(static_cast<uint>(startPoints.size()), [this, &startPoints, angle](const uint line) {
+		const Pixel& startPoint = startPoints[line];
+		const Pixel endPoint = getEndPointForBresenham(startPoint, angle, maxCoordinate);
+		//dc.DrawLine(startPoint.x * plotRatio, (maxCoordinate - startPoint.y) * plotRatio, endPoint.x * plotRatio, (maxCoordinate - endPoint.y) * plotRatio);
+
+		return findEdgePixelsAlongLine<Traversal>(startPoint, endPoint, pixelField);
+	});
+}
+
+// Edge pixel detection on the diagonal sweep lines of a whole degree angle. The end points and the DDA steps
+// are specialized for the octant of the angle and the tangents come from the precomputed angle table.
+template <SweepOctant octant>
+std::vector<std::vector<Pixel>> LineSweeping::findEdgePixelsInOctant(const std::vector<Pixel>& startPoints, const SweepAngle& angle) const {
+	constexpr bool steep = octant == SweepOctant::steepDown || octant == SweepOctant::steepUp;
+	constexpr bool ascending = octant == SweepOctant::steepUp || octant == SweepOctant::diagonalUp || octant == SweepOctant::shallowUp;
+
+	return findEdgePixelsInBands(static_cast<uint>(startPoints.size()), [this, &startPoints, &angle](const uint line) {
+		const Pixel& startPoint = startPoints[line];
+		const Pixel endPoint = sweepLineEndPoint<octant>(startPoint, angle, maxCoordinate);
+
+		return findEdgePixelsAlongLine<DdaOctantTraversal<steep, ascending>>(startPoint, endPoint, pixelField);
+	});
+}
+
+// Edge-event sweep of an axis-aligned angle (only the contour pixels and their neighbours on the sweep lines are visited).
+std::vector<std::vector<Pixel>> LineSweeping::findEdgePixelsWithBuckets(const bool vertical) const {
+	// Bucketing the contour pixels by the sweep line they lie on (counting sort by the line index).
+	// Horizontal sweep lines are indexed by Y and ordered by X, vertical ones the other way around.
+	std::vector<uint> bucketStart(maxCoordinate + 1, 0);
+	for (const RasterPixel& coordinate : coordinates) {
+		bucketStart[(vertical ? coordinate.x : coordinate.y) + 1]++;
+	}
+	for (int i = 0; i < maxCoordinate; i++) {
+		bucketStart[i + 1] += bucketStart[i];
+	}
+
+	std::vector<int> positions(coordinates.size());
+	std::vector<uint> bucketEnd(bucketStart.begin(), bucketStart.end() - 1);
+	for (const RasterPixel& coordinate : coordinates) {
+		positions[bucketEnd[vertical ? coordinate.x : coordinate.y]++] = vertical ? coordinate.y : coordinate.x;
+	}
+
+	// Sweeping the lines in the same order as the rasterized sweep (the last line is never swept).
+	// Each line only sorts its own bucket, so the lines of different bands do not interfere.
+	return findEdgePixelsInBands(std::max(maxCoordinate - 1, 0), [&](const uint line) {
+		std::vector<Pixel> edgePixels;
+
+		const auto begin = positions.begin() + bucketStart[line];
+		const auto end = positions.begin() + bucketStart[line + 1];
+		if (begin == end) {
+			return edgePixels;
 		}
-		if (pixelField[previousPixel.y][previousPixel.x].position == Position::inside && pixelField[pixel.y][pixel.x].position == Position::edge && (pixels.empty() || pixel != pixels.back())) {
-			pixels.emplace_back(pixel);
+		std::sort(begin, end);
+
+		// Each transition on the line involves an edge pixel, so only the pairs (p - 1, p) and (p, p + 1)
+		// around edge pixels p have to be checked. Candidates hold the index of the second pixel of a pair.
+		std::vector<int> candidates;
+		for (auto it = begin; it != end; it++) {
+			for (const int candidate : { *it, *it + 1 }) {
+				if (candidate >= 1 && candidate < maxCoordinate && (candidates.empty() || candidates.back() < candidate)) {
+					candidates.push_back(candidate);
+				}
+			}
 		}
-		if (previousPixel.position == Position::edge && pixel.position == Position::outside && (pixels.empty() || previousPixel != pixels.back())) {
-			pixels.emplace_back(previousPixel);
+
+		for (const int candidate : candidates) {
+			if (vertical) {
+				appendEdgePixels(edgePixels, pixelField.pixel(line, candidate - 1), pixelField.pixel(line, candidate));
+			}
+			else {
+				appendEdgePixels(edgePixels, pixelField.pixel(candidate - 1, line), pixelField.pixel(candidate, line));
+			}
 		}
+
+		return edgePixels;
+	});
+}
+
+// Edge-event sweep of a diagonal angle (only the contour pixels are visited, each of them on the DDA lines passing through it).
+std::vector<std::vector<Pixel>> LineSweeping::findEdgePixelsWithDiagonalBuckets(const std::vector<Pixel>& startPoints, const double angle) const {
+	// DDA walk of a sweep line from its left end point (see DdaTraversal): the i-th pixel lies at majorStart + i * majorStep
+	// on the major axis and at minorStart + i * minorDelta / denominator (an exact fraction) on the minor axis.
+	struct DiagonalLine {
+		bool steep = false;
+		int majorStart = 0;
+		int majorStep = 1;
+		int majorDelta = 0;
+		int minorStart = 0;
+		int minorDelta = 0;
+		int denominator = 1;
+	};
+
+	// Minor coordinate of the pixel at the given step of a line as the exact fraction whole + remainder / denominator.
+	const auto minorFraction = [](const DiagonalLine& line, const int step, int& whole, int& remainder) {
+		const long long numerator = static_cast<long long>(step) * line.minorDelta;
+		const long long carry = numerator >= 0 ? numerator / line.denominator : -((-numerator + line.denominator - 1) / line.denominator);
+		whole = static_cast<int>(line.minorStart + carry);
+		remainder = static_cast<int>(numerator - carry * line.denominator);
+	};
+
+	// Offset of a point along the normal of the sweep direction (cos, -sin).
+	const double normalX = std::sin(angle);
+	const double normalY = std::cos(angle);
+	const auto offset = [normalX, normalY](const int x, const int y) { return x * normalX + y * normalY; };
+
+	// Each pixel of a line is less than a pixel away from the line along the minor axis, so its offset lies within one
+	// of the offsets of the end points of the line (plus a margin for the rounding of the offsets).
+	constexpr double OFFSET_MARGIN = 1.0 + 1e-6;
+	const std::vector<Pixel> endPoints = diagonalEndPoints(startPoints, angle);
+	const uint lineCount = static_cast<uint>(startPoints.size());
+	std::vector<DiagonalLine> lines(lineCount);
+	std::vector<int> firstBins(lineCount);
+	std::vector<int> lastBins(lineCount);
+	int minBin = std::numeric_limits<int>::max();
+	int maxBin = std::numeric_limits<int>::min();
+
+	for (uint line = 0; line < lineCount; line++) {
+		// The lines are walked from left to right, the same as in findEdgePixelsAlongLine.
+		const bool swapped = startPoints[line].x > endPoints[line].x;
+		const int startX = static_cast<int>(swapped ? endPoints[line].x : startPoints[line].x);
+		const int startY = static_cast<int>(swapped ? endPoints[line].y : startPoints[line].y);
+		const int endX = static_cast<int>(swapped ? startPoints[line].x : endPoints[line].x);
+		const int endY = static_cast<int>(swapped ? startPoints[line].y : endPoints[line].y);
+		const int deltaX = endX - startX;
+		const int deltaY = endY - startY;
+
+		DiagonalLine& diagonalLine = lines[line];
+		diagonalLine.steep = std::abs(deltaY) > deltaX;
+		diagonalLine.majorStart = diagonalLine.steep ? startY : startX;
+		diagonalLine.majorStep = diagonalLine.steep && deltaY < 0 ? -1 : 1;
+		diagonalLine.majorDelta = diagonalLine.steep ? std::abs(deltaY) : deltaX;
+		diagonalLine.minorStart = diagonalLine.steep ? startX : startY;
+		diagonalLine.minorDelta = diagonalLine.steep ? deltaX : deltaY;
+		diagonalLine.denominator = std::max(diagonalLine.majorDelta, 1);
+
+		const double startOffset = offset(startX, startY);
+		const double endOffset = offset(endX, endY);
+		firstBins[line] = static_cast<int>(std::floor(std::min(startOffset, endOffset) - OFFSET_MARGIN));
+		lastBins[line] = static_cast<int>(std::floor(std::max(startOffset, endOffset) + OFFSET_MARGIN));
+		minBin = std::min(minBin, firstBins[line]);
+		maxBin = std::max(maxBin, lastBins[line]);
 	}
 
-	return pixels;
+	std::vector<std::vector<Pixel>> lineEdgePixels(lineCount);
+	if (lineCount == 0) {
+		return lineEdgePixels;
+	}
+
+	// Listing the candidate lines of each bin, the index of a bin is the floor of the offset (counting sort by the bin).
+	const uint binCount = static_cast<uint>(maxBin - minBin + 1);
+	std::vector<uint> binStart(binCount + 1, 0);
+	for (uint line = 0; line < lineCount; line++) {
+		for (int bin = firstBins[line]; bin <= lastBins[line]; bin++) {
+			binStart[bin - minBin + 1]++;
+		}
+	}
+	for (uint i = 0; i < binCount; i++) {
+		binStart[i + 1] += binStart[i];
+	}
+
+	std::vector<uint> binLines(binStart.back());
+	std::vector<uint> binEnd(binStart.begin(), binStart.end() - 1);
+	for (uint line = 0; line < lineCount; line++) {
+		for (int bin = firstBins[line]; bin <= lastBins[line]; bin++) {
+			binLines[binEnd[bin - minBin]++] = line;
+		}
+	}
+
+	// Bucketing the edge pixels by the lines they lie on. A candidate line visits the pixel if its DDA pixel
+	// at the major coordinate of the pixel is the pixel itself (step of the pixel along the line is kept for the order).
+	// The end point of each line is truncated separately, so a pixel may lie on no line, one or several of them.
+	struct LinePixel {
+		uint line = 0;
+		int step = 0;
+		int x = 0;
+		int y = 0;
+	};
+
+	std::vector<LinePixel> linePixels;
+	std::vector<uint> bucketStart(lineCount + 1, 0);
+	const int size = static_cast<int>(pixelField.size());
+	for (const RasterPixel& coordinate : coordinates) {
+		const int x = coordinate.x;
+		const int y = coordinate.y;
+		if (x < 0 || x >= size || y < 0 || y >= size || pixelField.position(x, y) != Position::edge) {
+			continue;
+		}
+
+		const int bin = static_cast<int>(std::floor(offset(x, y))) - minBin;
+		if (bin < 0 || bin >= static_cast<int>(binCount)) {
+			continue;
+		}
+
+		for (uint i = binStart[bin]; i < binStart[bin + 1]; i++) {
+			const DiagonalLine& line = lines[binLines[i]];
+			const int step = ((line.steep ? y : x) - line.majorStart) * line.majorStep;
+			if (step < 0 || step > line.majorDelta) {
+				continue;
+			}
+
+			// The pixel of the minor coordinate is the truncated coordinate (rounded towards zero).
+			int whole = 0;
+			int remainder = 0;
+			minorFraction(line, step, whole, remainder);
+			const int minor = whole < 0 && remainder != 0 ? whole + 1 : whole;
+			if (minor == (line.steep ? x : y)) {
+				linePixels.push_back(LinePixel{ binLines[i], step, x, y });
+				bucketStart[binLines[i] + 1]++;
+			}
+		}
+	}
+
+	for (uint i = 0; i < lineCount; i++) {
+		bucketStart[i + 1] += bucketStart[i];
+	}
+	std::vector<LinePixel> buckets(linePixels.size());
+	std::vector<uint> bucketEnd(bucketStart.begin(), bucketStart.end() - 1);
+	for (const LinePixel& linePixel : linePixels) {
+		buckets[bucketEnd[linePixel.line]++] = linePixel;
+	}
+
+	// Each line only sorts its own bucket by the steps along the line (a contour pixel may be listed more than once).
+	return findEdgePixelsInBands(lineCount, [&](const uint line) {
+		std::vector<Pixel> edgePixels;
+
+		const auto begin = buckets.begin() + bucketStart[line];
+		const auto end = buckets.begin() + bucketStart[line + 1];
+		std::sort(begin, end, [](const LinePixel& pixel1, const LinePixel& pixel2) { return pixel1.step < pixel2.step; });
+
+		const DiagonalLine& diagonalLine = lines[line];
+		for (auto it = begin; it != end; it++) {
+			if (it != begin && it->step == (it - 1)->step) {
+				continue;
+			}
+
+			// Sub-pixel point of the line in the cell (the same exact fraction as in DdaTraversal).
+			int whole = 0;
+			int remainder = 0;
+			minorFraction(diagonalLine, it->step, whole, remainder);
+			const double exactMinor = whole + static_cast<double>(remainder) / diagonalLine.denominator;
+			const int major = diagonalLine.majorStart + it->step * diagonalLine.majorStep;
+
+			const double exactX = diagonalLine.steep ? exactMinor : major;
+			const double exactY = diagonalLine.steep ? major : exactMinor;
+			edgePixels.push_back(Pixel(exactX, exactY, Position::edge, pixelField.directionPrevious(it->x, it->y), pixelField.directionNext(it->x, it->y)));
+		}
+
+		return edgePixels;
+	});
 }
 
-// Iterative chain building.
-void LineSweeping::buildChainsIteratively(const std::vector<Pixel>& edgePixels) {
-	wxClientDC dc(drawWindow);
+// Creating the object with the contour rotated around the middle of the bounding box.
+// The rotated contour points are connected with F4 moves into new chain codes, which are rasterized with their own
+// bounding box. The offset is the translation from the rotated (unclipped) coordinates to the new bounding box.
+LineSweeping LineSweeping::rotatedShape(const double angle, Pixel& offset) const {
+	LineSweeping rotated;
+	rotated.sweepEngine = sweepEngine;
+	rotated.fillEngine = fillEngine;
+	rotated.sweepBandCount = sweepBandCount;
+	rotated.chainStorage = chainStorage;
+
+	const Pixel center(maxCoordinate / 2, maxCoordinate / 2);
+	std::vector<ChainCode> rotatedChainCodes;
+	Pixel firstStart;
+	uint firstCoordinate = 0;
+
+	for (const ChainCode& chainCode : chainCodes) {
+		const uint coordinateCount = static_cast<uint>(chainCode.size());
+		if (coordinateCount == 0) {
+			continue;
+		}
+
+		// F4 commands (0 right, 1 up, 2 left, 3 down) between the rotated points. A command that goes back
+		// over the previous one cancels it, so rounding does not leave one pixel wide spikes on the contour.
+		const Pixel start = rotate2D(Pixel(coordinates[firstCoordinate]), center, angle);
+		std::string code;
+		int currentX = static_cast<int>(start.x);
+		int currentY = static_cast<int>(start.y);
+		const auto move = [&code](const char command) {
+			const char oppositeCommand = static_cast<char>('0' + (command - '0' + 2) % 4);
+			if (!code.empty() && code.back() == oppositeCommand) {
+				code.pop_back();
+			}
+			else {
+				code.push_back(command);
+			}
+		};
+
+		for (uint i = 1; i <= coordinateCount; i++) {
+			const Pixel target = rotate2D(Pixel(coordinates[firstCoordinate + i % coordinateCount]), center, angle);
+			for (; currentX < target.x; currentX++) {
+				move('0');
+			}
+			for (; currentX > target.x; currentX--) {
+				move('2');
+			}
+			for (; currentY < target.y; currentY++) {
+				move('1');
+			}
+			for (; currentY > target.y; currentY--) {
+				move('3');
+			}
+		}
+		firstCoordinate += coordinateCount;
+
+		// A spike can also remain where the end of the contour meets its start, so the start is moved past it.
+		Pixel startPoint = start;
+		while (code.size() >= 2 && (code.back() - '0' + 2) % 4 == code.front() - '0') {
+			const short direction = static_cast<short>(2 * (code.front() - '0'));
+			startPoint = Pixel(startPoint.x + ChainCodeDirection::moveX(direction), startPoint.y + ChainCodeDirection::moveY(direction));
+			code.erase(code.begin());
+			code.pop_back();
+		}
+
+		// If nothing is left of a contour after rounding, it is skipped.
+		if (code.empty()) {
+			continue;
+		}
+
+		if (rotatedChainCodes.empty()) {
+			firstStart = startPoint;
+		}
+		rotatedChainCodes.push_back(ChainCode(code, true, startPoint, 0, 1, true));
+	}
+
+	if (rotatedChainCodes.empty()) {
+		return rotated;
+	}
+
+	rotated.setChainCodes(std::move(rotatedChainCodes));
+
+	// The coordinates are already scaled, but the vicinity of the chains still depends on the scale of the object.
+	for (ChainCode& chainCode : rotated.chainCodes) {
+		chainCode.scale = chainCodes[0].scale;
+	}
+
+	// The first coordinate of the rotated object is the start point of its first chain code.
+	offset = Pixel(rotated.coordinates[0].x - firstStart.x, rotated.coordinates[0].y - firstStart.y);
+
+	return rotated;
+}
+
+// Sweeping the rotated object row by row. The chains of previous sweeps at the same angle are moved into the rotated object
+// (as chains of its 0 sweep), so the sweep can extend them, and they are rotated back afterwards. The chains of other angles
+// cannot be extended by this sweep, so they are left untouched.
+void LineSweeping::sweepRotatedContour(SweepState& state) const {
+	Pixel offset;
+	LineSweeping rotated = rotatedShape(state.sweepAngle, offset);
+	if (!rotated.isChainCodeSet()) {
+		return;
+	}
+	rotated.fillShape();
+
+	const Pixel center(maxCoordinate / 2, maxCoordinate / 2);
+
+	SweepState rotatedState(0.0);
+	std::vector<uint> sweptChains;		// Indices of the moved chains in the state.
+	std::vector<double> sweptAngles;	// Original angles of the moved chains.
+	for (uint i = 0; i < state.chains.size(); i++) {
+		if (!isInTolerance(toRadians(state.chains[i].angle), state.sweepAngle)) {
+			continue;
+		}
+
+		sweptChains.push_back(i);
+		sweptAngles.push_back(state.chains[i].angle);
+
+		Chain chain = std::move(state.chains[i]);
+		chain.angle = 0.0;
+		chain.transform([&](const Pixel& pixel) {
+			const Pixel rotatedPixel = rotate2DSubPixel(pixel, center, state.sweepAngle);
+			return Pixel(rotatedPixel.x + offset.x, rotatedPixel.y + offset.y, pixel.position, pixel.directionPrevious, pixel.directionNext);
+		});
+		rotatedState.chains.push_back(std::move(chain));
+	}
+
+	rotated.sweep(rotatedState);
+
+	for (uint i = 0; i < rotatedState.chains.size(); i++) {
+		Chain& chain = rotatedState.chains[i];
+		chain.transform([&](const Pixel& pixel) {
+			return rotate2DSubPixel(Pixel(pixel.x - offset.x, pixel.y - offset.y, pixel.position, pixel.directionPrevious, pixel.directionNext), center, -state.sweepAngle);
+		});
+
+		// Moved chains return to their place with their original angle, new chains were found at the angle of the state.
+		if (i < sweptChains.size()) {
+			chain.angle = sweptAngles[i];
+			state.chains[sweptChains[i]] = std::move(chain);
+		}
+		else {
+			chain.angle = toDegrees(state.sweepAngle);
+			state.chains.push_back(std::move(chain));
+		}
+	}
+}
 
+// Iterative chain building.
+void LineSweeping::buildChainsIteratively(SweepState& state, const std::vector<Pixel>& edgePixels) const {
 	const int vicinity = chainCodes[0].scale * 10;
 
 	std::vector<Pixel> currentEdgePixels;
 
 	// Finding matching pixels on the edge.
 	for (const Pixel& currentEdgePixel : edgePixels) {
-		for (const Pixel& previousEdgePixel : previousEdgePixels) {
+		for (const Pixel& previousEdgePixel : state.previousEdgePixels) {
 			if (isEdgePixelInVicinity(vicinity, currentEdgePixel.floor(), previousEdgePixel.floor())) {
 				currentEdgePixels.push_back(currentEdgePixel);
 				break;
@@ -253,15 +793,12 @@ void LineSweeping::buildChainsIteratively(const std::vector<Pixel>& edgePixels)
 		}
 	}
 
-	if (previousActualEdgePixels.empty()) {
+	if (state.previousActualEdgePixels.empty()) {
 		for (uint i = 1; i < edgePixels.size(); i++) {
 			Pixel p((edgePixels[i - 1] + edgePixels[i]) / 2.0);
 			
-			if (pixelField[p.y][p.x].position == Position::inside) {
-				Chain newChain;
-				newChain.angle = toDegrees(sweepAngle);
-				newChain.pixels.push_back(p);
-				chains.push_back(newChain);
+			if (pixelField.position(p.x, p.y) == Position::inside) {
+				startChain(state, p);
 
 				if (currentEdgePixels.empty()) {
 					currentEdgePixels = edgePixels;
@@ -282,44 +819,45 @@ void LineSweeping::buildChainsIteratively(const std::vector<Pixel>& edgePixels)
 				continue;
 			}
 
-			if (count > previousActualEdgePixels.size()) {
-				Chain newChain;
-				newChain.angle = toDegrees(sweepAngle);
-				newChain.pixels.push_back(midPixel);
-				chains.push_back(newChain);
+			if (count > state.previousActualEdgePixels.size()) {
+				startChain(state, midPixel);
 			}
 			else {
+				// The first created chain (of this angle) whose tail is close to one of the previous midpoints is extended.
+				// Only the chain tails around the previous midpoint are checked.
+				const bool horizontal = state.sweepAngle == 0.0;
+				const bool vertical = isInTolerance(state.sweepAngle, toRadians(90.0));
+
 				Pixel previousMidPixel;
-				std::vector<Chain>::iterator it = chains.end();
-				for (uint count2 = 1; count2 < previousActualEdgePixels.size(); count2 += 1) {
-					previousMidPixel = (previousActualEdgePixels[count2 - 1] + previousActualEdgePixels[count2]) / 2.0;
+				uint chainIndex = ChainTailGrid::NO_CHAIN;
+				for (uint count2 = 1; count2 < state.previousActualEdgePixels.size(); count2 += 1) {
+					previousMidPixel = (state.previousActualEdgePixels[count2 - 1] + state.previousActualEdgePixels[count2]) / 2.0;
 
-					it = std::find_if(chains.begin(), chains.end(), [this, &previousMidPixel, &midPixel](const Chain& chain) {
-						if ((sweepAngle == 0.0 && chain.pixels.back().y == midPixel.y) || (isInTolerance(sweepAngle, toRadians(90.0)) && chain.pixels.back().x == midPixel.x)) {
+					chainIndex = state.chainTails.findFirst(previousMidPixel, [&](const uint index) {
+						const Chain& chain = state.chains[index];
+						if ((horizontal && chain.lastPixel.y == midPixel.y) || (vertical && chain.lastPixel.x == midPixel.x)) {
 							return false;
 						}
 
-						return distance(chain.pixels.back(), previousMidPixel) < 10 * chainCodes[0].scale && isInTolerance(toRadians(chain.angle), sweepAngle);
+						return distance(chain.lastPixel, previousMidPixel) < 10 * chainCodes[0].scale && isInTolerance(toRadians(chain.angle), state.sweepAngle);
 					});
 
-					if (it != chains.end() && distance(previousMidPixel, midPixel) < vicinity) {
+					if (chainIndex != ChainTailGrid::NO_CHAIN && distance(previousMidPixel, midPixel) < vicinity) {
 						break;
 					}
 				}
 
-				if (it == chains.end() || distance(previousMidPixel, midPixel) > vicinity) {
-					Chain newChain;
-					newChain.angle = toDegrees(sweepAngle);
-					newChain.pixels.push_back(midPixel);
-					chains.push_back(newChain);
+				if (chainIndex == ChainTailGrid::NO_CHAIN || distance(previousMidPixel, midPixel) > vicinity) {
+					startChain(state, midPixel);
 				}
 				else {
 					count += 1;
-					if (pixelField[midPixel.y][midPixel.x].position != Position::inside) {
+					if (pixelField.position(midPixel.x, midPixel.y) != Position::inside) {
 						continue;
 					}
 
-					it->pixels.push_back(midPixel);
+					state.chainTails.move(chainIndex, state.chains[chainIndex].lastPixel, midPixel);
+					state.chains[chainIndex].append(midPixel);
 					//dc.SetPen(*wxRED_PEN);
 					//dc.DrawLine(previousMidPixel.x * plotRatio, (maxCoordinate - previousMidPixel.y) * plotRatio, midPixel.x * plotRatio, (maxCoordinate - midPixel.y) * plotRatio);
 					//dc.SetPen(*wxBLACK_PEN);
@@ -329,162 +867,70 @@ void LineSweeping::buildChainsIteratively(const std::vector<Pixel>& edgePixels)
 	}
 
 	// Current edge pixels become previous. Everyone gets old sometimes.
-	previousEdgePixels = edgePixels;
-	previousActualEdgePixels = currentEdgePixels;
+	state.previousEdgePixels = edgePixels;
+	state.previousActualEdgePixels = currentEdgePixels;
 }
 
-// Checking whether a target pixel is in the vicinity of the current pixel on the object edge.
-bool LineSweeping::isEdgePixelInVicinity(const uint vicinity, const Pixel& currentPixel, const Pixel& targetPixel) {
-	Pixel iteratingPixel = currentPixel;
-	
-	for (uint i = 0; i < vicinity; i++) {
-		// If the iterating and the target pixel match, we count success.
-		if (iteratingPixel == targetPixel) {
-			return true;
-		}
-
-		iteratingPixel = chainCodeMovePixel(iteratingPixel, iteratingPixel.directionPrevious);
-	}
-
-	iteratingPixel = currentPixel;
-
-	for (uint i = 0; i < vicinity; i++) {
-		// If the iterating and the target pixel match, we count success.
-		if (iteratingPixel == targetPixel) {
-			return true;
-		}
+// Starting a new chain at the given pixel.
+void LineSweeping::startChain(SweepState& state, const Pixel& pixel) const {
+	Chain newChain;
+	newChain.angle = toDegrees(state.sweepAngle);
+	newChain.keepsPixels = chainStorage == ChainStorage::allPixels;
+	newChain.append(pixel);
+	state.chains.push_back(newChain);
 
-		iteratingPixel = chainCodeMovePixel(iteratingPixel, iteratingPixel.directionNext);
-	}
-
-	return false;
+	state.chainTails.insert(static_cast<uint>(state.chains.size() - 1), pixel);
 }
 
-// Obtaining a new pixel after chain code move.
-Pixel LineSweeping::chainCodeMovePixel(const Pixel& currentPixel, const short direction) {
-	Pixel transformedPixel = currentPixel;
-
-	if (direction == 0) {
-		transformedPixel.x++;
-	}
-	else if (direction == 1) {
-		transformedPixel.x++;
-		transformedPixel.y++;
-	}
-	else if (direction == 2) {
-		transformedPixel.y++;
-	}
-	else if (direction == 3) {
-		transformedPixel.x--;
-		transformedPixel.y++;
-	}
-	else if (direction == 4) {
-		transformedPixel.x--;
-	}
-	else if (direction == 5) {
-		transformedPixel.x--;
-		transformedPixel.y--;
-	}
-	else if (direction == 6) {
-		transformedPixel.y--;
-	}
-	else if (direction == 7) {
-		transformedPixel.x++;
-		transformedPixel.y--;
-	}
-
-	return transformedPixel;
+// Checking whether a target pixel is in the vicinity of the current pixel on the object edge.
+// The pixel is moved up to (vicinity - 1) times by the chain code directions of the current pixel.
+// Since every move keeps the directions of the current pixel, the visited pixels form two straight rays,
+// so the target is tested in constant time instead of walking the rays step by step.
+bool LineSweeping::isEdgePixelInVicinity(const uint vicinity, const Pixel& currentPixel, const Pixel& targetPixel) const {
+	const int deltaX = static_cast<int>(targetPixel.x - currentPixel.x);
+	const int deltaY = static_cast<int>(targetPixel.y - currentPixel.y);
+
+	return (
+		isOnDirectionRay(vicinity, deltaX, deltaY, currentPixel.directionPrevious) ||
+		isOnDirectionRay(vicinity, deltaX, deltaY, currentPixel.directionNext)
+	);
 }
 
-
-
-// PLOT METHODS
-// Plotting the F4 chain code as an image.
-void LineSweeping::plotInput(wxDC& dc) const {
-	// Setting the color to green.
-	const wxPen pen(*wxBLACK_PEN);
-	const wxBrush brush(*wxBLACK_BRUSH);
-
-	// Plotting each point as a pixel.
-	for (const Pixel& point : coordinates) {
-		fillRectangle(dc, point.x, point.y, 1, maxCoordinate, pen, brush, plotRatio);
+// Checking whether a pixel offset is reached in less than the given number of moves in a chain code direction.
+bool LineSweeping::isOnDirectionRay(const uint steps, const int deltaX, const int deltaY, const short direction) {
+	// Without any moves, not even the starting pixel is checked.
+	if (steps == 0) {
+		return false;
 	}
-}
 
-// Plotting the object bounding box.
-void LineSweeping::plotBoundingBox(wxDC& dc) const {
-	// Plotting the four lines of the bounding box.
-	dc.DrawLine(0, 0, static_cast<int>(maxCoordinate * plotRatio), 0);
-	dc.DrawLine(static_cast<int>(maxCoordinate * plotRatio), 0, static_cast<int>(maxCoordinate * plotRatio), static_cast<int>(maxCoordinate * plotRatio));
-	dc.DrawLine(static_cast<int>(maxCoordinate * plotRatio), static_cast<int>(maxCoordinate * plotRatio), 0, static_cast<int>(maxCoordinate * plotRatio));
-	dc.DrawLine(0, static_cast<int>(maxCoordinate * plotRatio), 0, 0);
-}
+	// The starting pixel itself is always on the ray.
+	if (deltaX == 0 && deltaY == 0) {
+		return true;
+	}
 
-// Plotting the Bresenham line.
-void LineSweeping::plotBresenhamLine(wxDC& dc, const std::vector<Pixel>& rasterizedLine) const {
-	// Plotting each pixel of the line.
-	for (const Pixel& pixel : rasterizedLine) {
-		fillRectangle(dc, pixel.x, pixel.y, 1, maxCoordinate, *wxLIGHT_GREY_PEN, *wxLIGHT_GREY_BRUSH, plotRatio);
+	// Single move in the given direction (an invalid direction does not move the pixel).
+	const int moveX = ChainCodeDirection::moveX(direction);
+	const int moveY = ChainCodeDirection::moveY(direction);
+	if (moveX == 0 && moveY == 0) {
+		return false;
 	}
-}
 
-std::vector<wxColor> colors({
-	wxColor(255,   0,   0),  // Red (0)
-	wxColor(255,   0,   0),  // Red (0)
-	wxColor(255,   0,   0),  // Red (0)
-	wxColor(255,   0,   0),  // Red (0)
-	wxColor(255,   0,   0),  // Red (0)
-	wxColor(255,   0,   0),  // Red (0)
-	wxColor(255,   0,   0),  // Red (0)
-	wxColor(255,   0,   0),  // Red (0)
-	wxColor(255,   0,   0),  // Red (0)
-	wxColor(255,   0,   0),  // Red (0)
-	wxColor(255,   0,   0),  // Red (0)
-	wxColor(255,   0,   0),  // Red (0)
-	wxColor(255,   0,   0),  // Red (0)
-	wxColor(255,   0,   0),  // Red (0)
-	wxColor(255,   0,   0),  // Red (0)
-	wxColor(255,   0,   0),  // Red (0)
-	wxColor(255,   0,   0),  // Red (0)
-	wxColor(255,   0,   0),  // Red (0)
-	wxColor(255,   0,   0),  // Red (0)
-	wxColor(255,   0,   0),  // Red (0)
-	wxColor(255,   0,   0),  // Red (0)
-	wxColor(255,   0,   0),  // Red (0)
-	wxColor(255,   0,   0),  // Red (0)
-	//wxColor(  0,   0, 255),  // Blue (15)
-	//wxColor(34, 139,  34),  // Green (30)
-	//wxColor(255,  0,  255),  // Magenta (45)
-	//wxColor(255, 140,  80),  // Orange (60)
-	//wxColor(0, 0, 0),		// Black (75)
-	//wxColor(76, 0, 153),  // Purple (90)
-
-	//wxColor(255,  0,  255),  // Magenta (105)
-	//wxColor(255, 140,  80),  // Orange (120)
-	//wxColor(0, 0, 0),		// Black (135)
-	//wxColor(76, 0, 153),  // Purple (150)
-	//wxColor(34, 139,  34),  // Green (165)
-
-});
-
-// Plotting the segments.
-void LineSweeping::plotChains(wxDC& dc) const {
-	for (const Chain& chain : chains) {
-		const uint index = static_cast<uint>((chain.angle + 1.0) / 15);
-		dc.SetPen(wxPen(colors[index], 2));
-		
-		if (chain.pixels.size() < 10) {
-			continue;
-		}
+	// The offset has to be a positive multiple of the move.
+	if ((moveX == 0 && deltaX != 0) || (moveY == 0 && deltaY != 0)) {
+		return false;
+	}
 
-		for (uint i = 1; i < chain.pixels.size(); i++) {
-			dc.DrawLine(chain.pixels[i - 1].x * plotRatio, (maxCoordinate - chain.pixels[i - 1].y) * plotRatio, chain.pixels[i].x * plotRatio, (maxCoordinate - chain.pixels[i].y) * plotRatio);
-		}
+	const int moveCount = moveX != 0 ? deltaX * moveX : deltaY * moveY;
+	if (moveX != 0 && moveY != 0 && deltaY * moveY != moveCount) {
+		return false;
 	}
+
+	return moveCount > 0 && static_cast<uint>(moveCount) < steps;
 }
 
 
 
+
 // GETTERS AND SETTERS
 // Setting draw panel.
 void LineSweeping::setDrawPanel(wxWindow* drawWindow) {
@@ -506,332 +952,328 @@ void LineSweeping::setAngleOfRotation(const double angle) {
 	sweepAngle = angle;
 }
 
+// Setting the sweep engine.
+void LineSweeping::setSweepEngine(const SweepEngine engine) {
+	sweepEngine = engine;
+}
+
+// Setting the fill engine.
+void LineSweeping::setFillEngine(const FillEngine engine) {
+	fillEngine = engine;
+}
+
+// Setting the traversal of diagonal sweep lines.
+void LineSweeping::setLineTraversal(const LineTraversal traversal) {
+	lineTraversal = traversal;
+}
+
+// Setting the sweep mode.
+void LineSweeping::setSweepMode(const SweepMode mode) {
+	sweepMode = mode;
+}
+
+// Setting the number of bands of sweep lines (at least one).
+void LineSweeping::setSweepBandCount(const uint bandCount) {
+	sweepBandCount = std::max(bandCount, 1u);
+}
+
+// Setting the storage of the pixels of new chains.
+void LineSweeping::setChainStorage(const ChainStorage storage) {
+	chainStorage = storage;
+}
+
 
 
 // PUBLIC METHODS
 // Reading an F4 chain code file.
 bool LineSweeping::readFileF8(std::string file, const uint rotation, const uint scale) {
-	// Opening a file.
-	std::ifstream in(file);
-
-	// If a file is not open, we do not panic but abort the process.
-	if (!in.is_open()) {
-		return false;
-	}
-
-	// Clearing the previous coordinates.
-	chainCodes.clear();
-	coordinates.clear();
-	pixelField.clear();
-	chains.clear();
+	ParseError error;
+	return readFileF8(file, rotation, scale, error);
+}
 
-	// Reading first line.
-	std::string firstLine;
-	std::getline(in, firstLine);
-	if (firstLine != "CC Multi") {
+// Reading an F4 chain code file with the description of a potential error.
+bool LineSweeping::readFileF8(const std::string& file, const uint rotation, const uint scale, ParseError& error) {
+	// If a file cannot be read, we do not panic but abort the process (the previous object is kept).
+	std::vector<ChainCode> fileChainCodes;
+	if (!readChainCodes(file, rotation, scale, fileChainCodes, error)) {
 		return false;
 	}
 
-	// Reading the chain code.
-	bool clockwise = false;
-	int startX = 0;
-	int startY = 0;
-
-	std::string value;
-	bool isF4 = false;
-	while (std::getline(in, value, ';')) {
-		if (value == "F4") {
-			isF4 = true;
-		}
+	setChainCodes(std::move(fileChainCodes));
 
-		// Reading clockwise or anti-clockwise orientation.
-		std::getline(in, value, ';');
-		if (value == "CW") {
-			clockwise = true;
-		}
-		else {
-			clockwise = false;
-		}
-
-		// Reading the starting point.
-		std::getline(in, value, ',');
-		startX = std::stoi(value);
-		std::getline(in, value, ';');
-		startY = -std::stoi(value);
-		std::getline(in, value, ';');
-		Pixel startPixel(startX, startY);
-		startPixel = rotate2D(startPixel, Pixel(0, 0), rotation * (PI / 4));
+	return true;
+}
 
-		// Adding a new chain code.
-		std::getline(in, value);
-		ChainCode chainCode(value, clockwise, startPixel, rotation, scale, isF4);
-		chainCodes.push_back(chainCode);
+// Reading an object from a chain code container.
+bool LineSweeping::readContainerObject(const ChainCodeContainer& container, const uint index, const uint rotation, const uint scale, ParseError& error) {
+	// If the object cannot be read, the previous object is kept.
+	std::vector<ChainCode> objectChainCodes;
+	if (!container.readChainCodes(index, rotation, scale, objectChainCodes, error)) {
+		return false;
 	}
 
-	// Calculating the coordinates.
-	calculateCoordinatesFromChainCode();
-	calculateBoundingBox();
+	setChainCodes(std::move(objectChainCodes));
 
 	return true;
 }
 
 // Filling the loaded shape.
 void LineSweeping::fillShape() {
-	wxClientDC dc(drawWindow);
-
-	// Creating two stacks for filling the shape.
-	std::stack<uint> leftStack;
-	std::stack<uint> rightStack;
-	long startCoordinate = 0;
+	// The parity of each pixel is toggled 64 pixels at a time.
+	if (fillEngine == FillEngine::parityWords) {
+		fillShapeParityWords();
+		return;
+	}
 
-	// Iterating through the chain codes and filling the shape.
-	int j = 0;
-	for (const ChainCode& chainCode : chainCodes) {
-		for (uint i = 0; i < chainCode.code.size(); i++) {
-			// Getting the chain code element and the X and Y coordinates of the pixel.
-			const short code = chainCode.code[i];
-			const uint x = coordinates[startCoordinate + i].x;
-			const uint y = coordinates[startCoordinate + i].y;
-
-			// If the instruction is to go up, the left stack is pushed to if the right stack is empty.
-			if (code == 1 || code == 2 || code == 3) {
-				if (!rightStack.empty()) {
-					// Getting the top element from the right stack.
-					const uint right = rightStack.top();
-					rightStack.pop();
-
-					// Setting undefined pixels to inside if left and right pixel coordinates are not flipped (left < right).
-					if (right > x) {
-						for (uint pixelX = x + 1; pixelX < right; pixelX++) {
-							if (pixelField[y][pixelX].position == Position::inside) {
-								pixelField[y][pixelX].position = Position::outside;
-								//fillRectangle(dc, pixelX, y, 1, maxCoordinate, *wxWHITE_PEN, *wxWHITE_BRUSH, plotRatio);
-							}
-							else if (pixelField[y][pixelX].position != Position::edge) {
-								pixelField[y][pixelX].position = Position::inside;
-								//fillRectangle(dc, pixelX, y, 1, maxCoordinate, *wxGREEN_PEN, *wxGREEN_BRUSH, plotRatio);
-							}
-						}
-					}
-					// Setting pixels to outside if left and right pixel coordinates are flipped (left > right).
-					else {
-						for (uint pixelX = right + 1; pixelX < x; pixelX++) {
-							if (pixelField[y][pixelX].position == Position::inside) {
-								pixelField[y][pixelX].position = Position::outside;
-								//fillRectangle(dc, pixelX, y, 1, maxCoordinate, *wxWHITE_PEN, *wxWHITE_BRUSH, plotRatio);
-							}
-							else if (pixelField[y][pixelX].position != Position::edge) {
-								pixelField[y][pixelX].position = Position::inside;
-								//fillRectangle(dc, pixelX, y, 1, maxCoordinate, *wxGREEN_PEN, *wxGREEN_BRUSH, plotRatio);
-							}
-						}
-					}
-				}
-				else {
-					leftStack.push(x);
-					//fillRectangle(dc, x, y, 1, maxCoordinate, *wxRED_PEN, *wxRED_BRUSH, plotRatio);
-				}
+	// Toggling the pixels of each span: inside pixels become outside, other non-edge pixels become inside.
+	forEachFillSpan([this](const uint y, const uint from, const uint to) {
+		for (uint pixelX = from; pixelX < to; pixelX++) {
+			if (pixelField.position(pixelX, y) == Position::inside) {
+				pixelField.setPosition(pixelX, y, Position::outside);
+				//fillRectangle(dc, pixelX, y, 1, maxCoordinate, *wxWHITE_PEN, *wxWHITE_BRUSH, plotRatio);
 			}
-			// If the instruction is to go down, the right stack is pushed to if the left stack is empty.
-			else if (code == 5 || code == 6 || code == 7) {
-				if (!leftStack.empty()) {
-					// Getting the top element from the left stack.
-					const uint left = leftStack.top();
-					leftStack.pop();
-
-					// Setting undefined pixels to inside if left and right pixel coordinates are not flipped (left < right).
-					if (left < x) {
-						for (uint pixelX = left + 1; pixelX < x; pixelX++) {
-							if (pixelField[y - 1][pixelX].position == Position::inside) {
-								pixelField[y - 1][pixelX].position = Position::outside;
-								//fillRectangle(dc, pixelX, y - 1, 1, maxCoordinate, *wxWHITE_PEN, *wxWHITE_BRUSH, plotRatio);
-							}
-							else if (pixelField[y - 1][pixelX].position != Position::edge) {
-								pixelField[y - 1][pixelX].position = Position::inside;
-								//fillRectangle(dc, pixelX, y - 1, 1, maxCoordinate, *wxGREEN_PEN, *wxGREEN_BRUSH, plotRatio);
-							}
-						}
-					}
-					// Setting pixels to outside if left and right pixel coordinates are flipped (left > right).
-					else {
-						for (uint pixelX = x + 1; pixelX < left; pixelX++) {
-							if (pixelField[y - 1][pixelX].position == Position::inside) {
-								pixelField[y - 1][pixelX].position = Position::outside;
-								//fillRectangle(dc, pixelX, y - 1, 1, maxCoordinate, *wxWHITE_PEN, *wxWHITE_BRUSH, plotRatio);
-							}
-							else if (pixelField[y - 1][pixelX].position != Position::edge) {
-								pixelField[y - 1][pixelX].position = Position::inside;
-								//fillRectangle(dc, pixelX, y - 1, 1, maxCoordinate, *wxGREEN_PEN, *wxGREEN_BRUSH, plotRatio);
-							}
-						}
-					}
-				}
-				else {
-					rightStack.push(x);
-					//fillRectangle(dc, x, y, 1, maxCoordinate, *wxBLUE_PEN, *wxBLUE_BRUSH, plotRatio);
-				}
+			else if (pixelField.position(pixelX, y) != Position::edge) {
+				pixelField.setPosition(pixelX, y, Position::inside);
+				//fillRectangle(dc, pixelX, y, 1, maxCoordinate, *wxGREEN_PEN, *wxGREEN_BRUSH, plotRatio);
 			}
+		}
+	});
 
-			// Setting the current pixel to edge.
-			pixelField[y][x].position = Position::edge;
-			pixelField[y][x].directionPrevious = coordinates[startCoordinate + i].directionPrevious;
-			pixelField[y][x].directionNext = coordinates[startCoordinate + i].directionNext;
+	// Setting undefined pixels to outside.
+	for (uint y = 0; y < pixelField.size(); y++) {
+		for (uint x = 0; x < pixelField.size(); x++) {
+			if (pixelField.position(x, y) == Position::undefined) {
+				pixelField.setPosition(x, y, Position::outside);
+			}
 		}
+	}
+}
 
-		leftStack = std::stack<uint>();
-		rightStack = std::stack<uint>();
-		startCoordinate += chainCode.code.size();
-		j++;
+// Start points of the diagonal sweep lines of an angle in the sweep order.
+std::vector<Pixel> LineSweeping::diagonalStartPoints(const double angle) const {
+	std::vector<Pixel> startPoints;
+
+	if (toDegrees(angle) < 90.0) {
+		for (int y = 0; y < maxCoordinate; y += 1) {
+			startPoints.push_back(Pixel(0, y));
+		}
+		for (int x = 0; x < maxCoordinate; x += 1) {
+			startPoints.push_back(Pixel(x, maxCoordinate));
+		}
+	}
+	else if (toDegrees(angle) < 180.0) {
+		for (int x = 0; x < maxCoordinate; x += 1) {
+			startPoints.push_back(Pixel(x, maxCoordinate));
+		}
+		for (int y = maxCoordinate; y >= 0; y -= 1) {
+			startPoints.push_back(Pixel(maxCoordinate, y));
+		}
 	}
 
-	// Setting undefined pixels to outside.
-	for (uint y = 0; y < pixelField.size(); y++) {
-		for (uint x = 0; x < pixelField[y].size(); x++) {
-			if (pixelField[y][x].position == Position::undefined) {
-				pixelField[y][x].position = Position::outside;
+	return startPoints;
+}
+
+// End points of the diagonal sweep lines from the given start points (the same ones the DDA traversal of the sweep uses).
+std::vector<Pixel> LineSweeping::diagonalEndPoints(const std::vector<Pixel>& startPoints, const double angle) const {
+	std::vector<Pixel> endPoints(startPoints.size());
+
+	// Whole degrees take the end points of their octant, other angles are computed at run time.
+	if (isInTolerance(toDegrees(angle), std::round(toDegrees(angle))) && static_cast<int>(std::round(toDegrees(angle))) % 90 != 0) {
+		const SweepAngle& sweepAngle = SWEEP_ANGLES[static_cast<int>(std::round(toDegrees(angle))) % 180];
+		for (uint i = 0; i < startPoints.size(); i++) {
+			switch (sweepAngle.octant) {
+			case SweepOctant::shallowDown:
+				endPoints[i] = sweepLineEndPoint<SweepOctant::shallowDown>(startPoints[i], sweepAngle, maxCoordinate);
+				break;
+			case SweepOctant::diagonalDown:
+				endPoints[i] = sweepLineEndPoint<SweepOctant::diagonalDown>(startPoints[i], sweepAngle, maxCoordinate);
+				break;
+			case SweepOctant::steepDown:
+				endPoints[i] = sweepLineEndPoint<SweepOctant::steepDown>(startPoints[i], sweepAngle, maxCoordinate);
+				break;
+			case SweepOctant::steepUp:
+				endPoints[i] = sweepLineEndPoint<SweepOctant::steepUp>(startPoints[i], sweepAngle, maxCoordinate);
+				break;
+			case SweepOctant::diagonalUp:
+				endPoints[i] = sweepLineEndPoint<SweepOctant::diagonalUp>(startPoints[i], sweepAngle, maxCoordinate);
+				break;
+			case SweepOctant::shallowUp:
+				endPoints[i] = sweepLineEndPoint<SweepOctant::shallowUp>(startPoints[i], sweepAngle, maxCoordinate);
+				break;
 			}
 		}
 	}
+	else {
+		for (uint i = 0; i < startPoints.size(); i++) {
+			endPoints[i] = getEndPointForBresenham(startPoints[i], angle, maxCoordinate);
+		}
+	}
+
+	return endPoints;
 }
 
 // Sweeping the object.
 void LineSweeping::sweep() {
-	// Creating the object for drawing the Bresenham line.
-	wxClientDC dc(drawWindow);
+	// The chains of the previous sweeps are kept and extended.
+	SweepState state(sweepAngle);
+	state.chains = std::move(chains);
 
-	// Creating a Bresenham point vector.
-	std::vector<Pixel> bresenhamPixels(maxCoordinate);
+	// The bands of sweep lines are run as tasks of a new parallel region.
+	#pragma omp parallel if(sweepBandCount > 1)
+	#pragma omp single
+	sweep(state);
+
+	chains = std::move(state.chains);
+}
 
+// Sweeping the filled object with the given state (the object itself is not modified).
+// The edge pixels of the sweep lines are found in parallel bands, since each line only reads the object.
+// Chains are then built line by line in the sweep order: a midpoint may extend any earlier chain
+// (the first one in the order of creation), so the chains of separate bands could not be stitched
+// into the same result as a single sequential sweep.
+void LineSweeping::sweep(SweepState& state) const {
+	// In the rotated contour mode, every angle but 0 is swept as the rows of the rotated object.
+	if (sweepMode == SweepMode::rotatedContour && !isInTolerance(state.sweepAngle, 0.0)) {
+		sweepRotatedContour(state);
+		return;
+	}
+
+	// Indexing the tails of already existing chains.
+	state.chainTails = ChainTailGrid(maxCoordinate, 10 * chainCodes[0].scale);
+	for (uint i = 0; i < state.chains.size(); i++) {
+		state.chainTails.insert(i, state.chains[i].lastPixel);
+	}
+
+	const bool horizontal = isInTolerance(state.sweepAngle, 0.0);
+	const bool vertical = isInTolerance(state.sweepAngle, toRadians(90));
+	const uint lineCount = static_cast<uint>(std::max(maxCoordinate - 1, 0));
+
+	std::vector<std::vector<Pixel>> lineEdgePixels;
+
+	// The edge-event engine sweeps the lines without rasterizing them, it only visits the contour pixels bucketed by line.
+	if (sweepEngine == SweepEngine::edgeBuckets && (horizontal || vertical)) {
+		lineEdgePixels = findEdgePixelsWithBuckets(vertical);
+	}
 	// If the line is horizontal, there is no need for sophisticated rasterization method.
-	if (isInTolerance(sweepAngle, 0.0)) {
-		// Creating the starting line segment points.
-		for (int i = 0; i < maxCoordinate; i++) {
-			bresenhamPixels[i] = Pixel(i, 0, pixelField[0][i].position, pixelField[0][i].directionPrevious, pixelField[0][i].directionNext);
-		}
-
-		// Moving the rasterized line segment vertically.
-		for (int i = 0; i < maxCoordinate - 1; i++) {
-			const std::vector<Pixel> edgePixels = findEdgePixels(bresenhamPixels);  // Finding edge pixels on the rasterized line.
-			if (!edgePixels.empty()) {
-				buildChainsIteratively(edgePixels);  // Iterative chain building.
-			}
-
-			// Increasing each pixel Y coordinate.
-			std::transform(
-				bresenhamPixels.begin(),
-				bresenhamPixels.end(),
-				bresenhamPixels.begin(),
-				[this](const Pixel& pixel) {
-					return Pixel(pixel.x, pixel.y + 1, pixelField[pixel.y + 1][pixel.x].position, pixelField[pixel.y + 1][pixel.x].directionPrevious, pixelField[pixel.y + 1][pixel.x].directionNext);
-				}
-			);
-		}
+	else if (horizontal) {
+		lineEdgePixels = findEdgePixelsInBands(lineCount, [this](const uint line) {
+			// Creating the line segment points of the row.
+			std::vector<RasterPixel> bresenhamPixels(maxCoordinate);
+			for (int i = 0; i < maxCoordinate; i++) {
+				bresenhamPixels[i] = pixelField.pixel(i, line);
+			}
+
+			return findEdgePixels(bresenhamPixels);  // Finding edge pixels on the rasterized line.
+		});
 	}
 	// If the line is vertical, there is no need for sophisticated rasterization method.
-	else if (isInTolerance(sweepAngle, toRadians(90))) {
-		// Creating the starting line segment points.
-		for (int i = 0; i < maxCoordinate; i++) {
-			bresenhamPixels[i] = Pixel(0, i, pixelField[i][0].position, pixelField[i][0].directionPrevious, pixelField[i][0].directionNext);
-		}
-
-		// Moving the rasterized line segment vertically.
-		for (int i = 0; i < maxCoordinate - 1; i++) {
-			const std::vector<Pixel> edgePixels = findEdgePixels(bresenhamPixels);  // Finding edge pixels on the rasterized line.
-			if (!edgePixels.empty()) {
-				buildChainsIteratively(edgePixels);  // Iterative chain building.
-			}
-
-			// Increasing each pixel X coordinate.
-			std::transform(
-				bresenhamPixels.begin(),
-				bresenhamPixels.end(),
-				bresenhamPixels.begin(),
-				[this](const Pixel& pixel) {
-					return Pixel(pixel.x + 1, pixel.y, pixelField[pixel.y][pixel.x + 1].position, pixelField[pixel.y][pixel.x + 1].directionPrevious, pixelField[pixel.y][pixel.x + 1].directionNext);
-				}
-			);
-		}
+	else if (vertical) {
+		lineEdgePixels = findEdgePixelsInBands(lineCount, [this](const uint line) {
+			// Creating the line segment points of the column.
+			std::vector<RasterPixel> bresenhamPixels(maxCoordinate);
+			for (int i = 0; i < maxCoordinate; i++) {
+				bresenhamPixels[i] = pixelField.pixel(line, i);
+			}
+
+			return findEdgePixels(bresenhamPixels);  // Finding edge pixels on the rasterized line.
+		});
 	}
 	// If the line is neither horizontal nor vertical, we have to reach for Bresenham rasterization algorithm.
 	else {
-		if (toDegrees(sweepAngle) < 90.0) {
-			for (int y = 0; y < maxCoordinate; y += 1) {
-				// Bresenham rasterization algorithm.
-				Pixel startPoint(Pixel(0, y));
-				Pixel endPoint = getEndPointForBresenham(startPoint, sweepAngle, maxCoordinate);
-				//dc.DrawLine(startPoint.x * plotRatio, (maxCoordinate - startPoint.y) * plotRatio, endPoint.x * plotRatio, (maxCoordinate - endPoint.y) * plotRatio);
-
-				std::vector<Pixel> edgePixels = findEdgePixelsWithBresenham(startPoint, endPoint, pixelField);
-				if (!edgePixels.empty()) {
-					buildChainsIteratively(edgePixels);  // Iterative chain building.
-				}
-			}
-			for (int x = 0; x < maxCoordinate; x += 1) {
-				// Bresenham rasterization algorithm.
-				Pixel startPoint = Pixel(x, maxCoordinate);
-				Pixel endPoint = getEndPointForBresenham(Pixel(x, maxCoordinate), sweepAngle, maxCoordinate);
-				std::vector<Pixel> edgePixels = findEdgePixelsWithBresenham(startPoint, endPoint, pixelField);
-				if (!edgePixels.empty()) {
-					buildChainsIteratively(edgePixels);  // Iterative chain building.
-				}
-			}
+		const std::vector<Pixel> startPoints = diagonalStartPoints(state.sweepAngle);
+		const double angle = state.sweepAngle;
+
+		// The edge-event engine finds the same edge pixels as the DDA traversal from the contour pixels on each line.
+		if (sweepEngine == SweepEngine::edgeBuckets && lineTraversal == LineTraversal::dda) {
+			lineEdgePixels = findEdgePixelsWithDiagonalBuckets(startPoints, angle);
 		}
-		else if (toDegrees(sweepAngle) < 180.0) {
-			for (int x = 0; x < maxCoordinate; x += 1) {
-				// Bresenham rasterization algorithm.
-				Pixel startPoint(Pixel(x, maxCoordinate));
-				Pixel endPoint = getEndPointForBresenham(Pixel(x, maxCoordinate), sweepAngle, maxCoordinate);
-				std::vector<Pixel> edgePixels = findEdgePixelsWithBresenham(startPoint, endPoint, pixelField);
-				if (!edgePixels.empty()) {
-					buildChainsIteratively(edgePixels);  // Iterative chain building.
-				}
-			}
-			for (int y = maxCoordinate; y >= 0; y -= 1) {
-				// Bresenham rasterization algorithm.
-				auto startPoint(Pixel(maxCoordinate, y));
-				auto endPoint = getEndPointForBresenham(startPoint, sweepAngle, maxCoordinate);
-				std::vector<Pixel> edgePixels = findEdgePixelsWithBresenham(startPoint, endPoint, pixelField);
-				if (!edgePixels.empty()) {
-					buildChainsIteratively(edgePixels);  // Iterative chain building.
-				}
+		// Otherwise, each line is traversed between its end points with the chosen traversal (instantiated once per traversal).
+		else if (lineTraversal == LineTraversal::bresenham) {
+			lineEdgePixels = findEdgePixelsOnLines<BresenhamTraversal>(startPoints, angle);
+		}
+		else if (lineTraversal == LineTraversal::clearyWyvill) {
+			lineEdgePixels = findEdgePixelsOnLines<ClearyWyvillTraversal>(startPoints, angle);
+		}
+		// Whole degrees (all angles of the multi-sweep) are dispatched once to the loop specialized for their octant.
+		else if (isInTolerance(toDegrees(angle), std::round(toDegrees(angle))) && static_cast<int>(std::round(toDegrees(angle))) % 90 != 0) {
+			const SweepAngle& sweepAngle = SWEEP_ANGLES[static_cast<int>(std::round(toDegrees(angle))) % 180];
+			switch (sweepAngle.octant) {
+			case SweepOctant::shallowDown:
+				lineEdgePixels = findEdgePixelsInOctant<SweepOctant::shallowDown>(startPoints, sweepAngle);
+				break;
+			case SweepOctant::diagonalDown:
+				lineEdgePixels = findEdgePixelsInOctant<SweepOctant::diagonalDown>(startPoints, sweepAngle);
+				break;
+			case SweepOctant::steepDown:
+				lineEdgePixels = findEdgePixelsInOctant<SweepOctant::steepDown>(startPoints, sweepAngle);
+				break;
+			case SweepOctant::steepUp:
+				lineEdgePixels = findEdgePixelsInOctant<SweepOctant::steepUp>(startPoints, sweepAngle);
+				break;
+			case SweepOctant::diagonalUp:
+				lineEdgePixels = findEdgePixelsInOctant<SweepOctant::diagonalUp>(startPoints, sweepAngle);
+				break;
+			case SweepOctant::shallowUp:
+				lineEdgePixels = findEdgePixelsInOctant<SweepOctant::shallowUp>(startPoints, sweepAngle);
+				break;
 			}
 		}
+		else {
+			lineEdgePixels = findEdgePixelsOnLines<DdaTraversal>(startPoints, angle);
+		}
 	}
 
-	previousEdgePixels.clear();
-	previousActualEdgePixels.clear();
-}
-
-FeatureVector calculateFeatureVector(const std::vector<LineSweeping>& sweepVector) {
-	std::vector<std::pair<double, double>> features;
-	for (uint i = 0; i < sweepVector.size(); i++) {
-		for (uint j = 0; j < sweepVector[i].chains.size(); j++) {
-			Chain chain = sweepVector[i].chains[j];
-
-			//std::vector<LineSegment> ls = douglasPeucker(chain.pixels, LineSegment(chain.pixels.front(), chain.pixels.back()), 50.0);
-			//std::vector<Pixel> pixels(2 * ls.size());
-			//double dist = 0;
-			//for (uint k = 0; k < ls.size(); k++) {
-			//	dist += distance(ls[k].p1, ls[k].p2);
-			//	pixels[2 * k] = ls[k].p1;
-			//	pixels[2 * k + 1] = ls[k].p2;
-			//}
-
-			//const double avgError = averageDistanceBetweenPixelsAndLineSegment(pixels, LineSegment(chain.pixels.front(), chain.pixels.back()));
+	// Building the chains line by line.
+	for (const std::vector<Pixel>& edgePixels : lineEdgePixels) {
+		if (!edgePixels.empty()) {
+			buildChainsIteratively(state, edgePixels);  // Iterative chain building.
+		}
+	}
 
-			//features.push_back(std::make_pair(dist, avgError));
+	state.previousEdgePixels.clear();
+	state.previousActualEdgePixels.clear();
+	state.chainTails = ChainTailGrid();
+}
 
-			features.push_back(std::make_pair(distance(chain.pixels.front(), chain.pixels.back()), 0.0));
+FeatureVector calculateFeatureVector(const std::vector<std::vector<Chain>>& angleChains) {
+	// Chains shorter than this share of the longest chain are not a part of the feature vector.
+	constexpr double MIN_RELATIVE_LENGTH = 0.2;
+
+	// Each angle is a task that streams the end-to-end distances of its chains and keeps its longest distance.
+	// A distance that is too short compared to the longest distance of its own angle is also too short compared to
+	// the longest distance overall, so only the remaining candidates are stored.
+	std::vector<std::vector<double>> candidates(angleChains.size());
+	std::vector<double> maxLengths(angleChains.size(), 0.0);
+	for (uint i = 0; i < angleChains.size(); i++) {
+		#pragma omp task firstprivate(i) shared(angleChains, candidates, maxLengths)
+		{
+			double maxLength = 0.0;
+			for (const Chain& chain : angleChains[i]) {
+				const double length = distance(chain.firstPixel, chain.lastPixel);
+				maxLength = std::max(maxLength, length);
+
+				if (!(length / maxLength < MIN_RELATIVE_LENGTH)) {
+					candidates[i].push_back(length);
+				}
+			}
+			maxLengths[i] = maxLength;
 		}
 	}
+	#pragma omp taskwait
+
+	// Merging the candidates of all angles that are long enough compared to the longest distance overall.
+	const double maxLength = maxLengths.empty() ? 1.0 : *std::max_element(maxLengths.begin(), maxLengths.end());
+	std::vector<double> lengths;
+	for (const std::vector<double>& angleCandidates : candidates) {
+		std::copy_if(angleCandidates.begin(), angleCandidates.end(), std::back_inserter(lengths), [maxLength](const double length) { return !(length / maxLength < MIN_RELATIVE_LENGTH); });
+	}
 
-	std::sort(features.begin(), features.end());
-	std::reverse(features.begin(), features.end());
-	const double maxLength = features.empty() ? 1.0 : features[0].first;
-	for (uint i = 0; i < features.size(); i++) {
-		features[i].first /= maxLength;
+	// Only the remaining chains are sorted from the longest to the shortest and normalized.
+	std::sort(lengths.begin(), lengths.end(), std::greater<double>());
+	std::vector<std::pair<double, double>> features(lengths.size());
+	for (uint i = 0; i < lengths.size(); i++) {
+		features[i] = std::make_pair(lengths[i] / maxLength, 0.0);
 	}
-	features.erase(std::remove_if(features.begin(), features.end(), [](const std::pair<double, double>& p) { return p.first < 0.2; }), features.end());
 
 	// Creating a feature vector.
 	FeatureVector featureVector(features);
@@ -1,19 +1,69 @@
 #pragma once
 
+#include <cstdint>
 #include <queue>
 #include <vector>
 
 #include "HelperFunctions.hpp"
 #include "ChainCode.hpp"
+#include "ChainCodeContainer.hpp"
+#include "ChainCodeReader.hpp"
 #include "FeatureVector.hpp"
 #include "Pixel.hpp"
-#include "stdafx.h"
+#include "PixelField.hpp"
+#include "SweepOctant.hpp"
+#include "SweepState.hpp"
+
+
+// FORWARD DECLARATIONS
+// The GUI types are only needed by the plot methods (LineSweepingPlot.cpp),
+// so the sweep engine itself can be built without wxWidgets.
+class wxBrush;
+class wxDC;
+class wxPen;
+class wxWindow;
 
 
 // CONSTANTS
 const double MAGNIFY_FACTOR = 1.5;
 
 
+// Sweep engine enum class.
+enum class SweepEngine {
+	raster,		 // Every sweep line is rasterized through the whole bounding box.
+	edgeBuckets  // Sweep lines only visit the contour pixels bucketed by line (diagonal ones with the DDA traversal between their end points, see sweep).
+};
+
+
+// Fill engine enum class.
+enum class FillEngine {
+	pixels,		 // Pixels of each span are toggled one by one, undefined pixels are set to outside in a separate pass.
+	parityWords  // Spans toggle parity bits 64 pixels at a time, all positions are set in a single pass.
+};
+
+
+// Line traversal enum class (traversal of diagonal sweep lines between their end points, see LineTraversal.hpp).
+enum class LineTraversal {
+	dda,		  // Integer DDA (the minor coordinate is truncated).
+	bresenham,	  // Bresenham algorithm (the minor coordinate is rounded).
+	clearyWyvill  // Cleary-Wyvill algorithm (every cell the line passes through).
+};
+
+
+// Chain storage enum class.
+enum class ChainStorage {
+	endPoints,  // Chains only keep their end points, length and pixel count (enough for the feature vector).
+	allPixels   // Chains also keep all of their pixels (needed for plotting).
+};
+
+
+// Sweep mode enum class.
+enum class SweepMode {
+	sweepLines,		// Sweep lines of every angle are traversed over the filled object.
+	rotatedContour  // For every angle but 0, the contour is rotated so that the sweep lines become rows, then it is filled and swept row by row.
+};
+
+
 // MAIN CLASS
 // Line sweeping class.
 class LineSweeping {
@@ -21,26 +71,43 @@ public:
 	// PRIVATE VARIABLES
 	wxWindow* drawWindow = nullptr;		 // Draw window.
 	std::vector<ChainCode> chainCodes;   // F4 chain code.
-	std::vector<Pixel> coordinates;      // Point coordinates.
+	std::vector<RasterPixel> coordinates;  // Point coordinates.
 	PixelField pixelField;				 // Pixel field with pixels and their positions according to the object (edge, outside or inside).
 	int maxCoordinate = 0;				 // Maximum coordinate.
 	double plotRatio = 1.0;			     // Ratio factor for drawing.
 	uint edgePixelCount = 0;
 
-	std::vector<Pixel> previousEdgePixels;
-	std::vector<Pixel> previousActualEdgePixels;
 	double sweepAngle = 0.0;			 // Sweep line angle of rotation [0-180].
 	std::vector<Chain> chains;		     // Vector of segments.
+	SweepEngine sweepEngine = SweepEngine::edgeBuckets;  // Engine used for sweeping.
+	FillEngine fillEngine = FillEngine::parityWords;	 // Engine used for filling.
+	LineTraversal lineTraversal = LineTraversal::dda;	 // Traversal of diagonal sweep lines.
+	SweepMode sweepMode = SweepMode::sweepLines;		 // Mode of sweeping the angles other than 0.
+	uint sweepBandCount = 1;							 // Number of bands of sweep lines that are processed in parallel.
+	ChainStorage chainStorage = ChainStorage::endPoints;  // Storage of the pixels of new chains.
 
 
 	// PRIVATE HELPER METHODS
 	void calculateCoordinatesFromChainCode();																																	   // Transforming chain code to coordinates.
+	void setChainCodes(std::vector<ChainCode>&& newChainCodes);																												   // Setting new chain codes of the object.
 	void calculateBoundingBox();																																				   // Calculation of a bounding box according to point coordinates.
 	void fillRectangle(wxDC& dc, const int x, const int y, const int pixelSize, const int maxCoordinate, const wxPen& pen, const wxBrush& brush, const double ratio = 1.0) const;  // Filling a rectangle at X and Y coordinates.
-	std::vector<Pixel> findEdgePixels(const std::vector<Pixel>& rasterizedLine) const;																	   // Finding edge pixel pairs.
-	void buildChainsIteratively(const std::vector<Pixel>& edgePixels);																					   // Iterative chain building.
-	bool isEdgePixelInVicinity(const uint vicinity, const Pixel& currentPixel, const Pixel& targetPixel);																		   // Checking whether a target pixel is in the vicinity of the current pixel on the object edge.
-	Pixel chainCodeMovePixel(const Pixel& currentPixel, const short direction);																									   // Obtaining a new pixel after chain code move.
+	template <typename ToggleSpan> void forEachFillSpan(ToggleSpan toggleSpan) const;																			   // Walking the spans between stack-matched contour pixels.
+	void fillShapeParityWords();																																   // Filling the loaded shape with parity words.
+	static void toggleParityWords(uint64_t* row, const uint from, const uint to);																				   // Toggling the parity bits of a span.
+	std::vector<Pixel> findEdgePixels(const std::vector<RasterPixel>& rasterizedLine) const;																	   // Finding edge pixel pairs.
+	void appendEdgePixels(std::vector<Pixel>& pixels, const RasterPixel& previousPixel, const RasterPixel& pixel) const;										   // Adding the edge pixels of a pair of neighbouring pixels.
+	template <typename Traversal> std::vector<std::vector<Pixel>> findEdgePixelsOnLines(const std::vector<Pixel>& startPoints, const double angle) const;		   // Edge pixel detection on the diagonal sweep lines traversed between their end points.
+	template <SweepOctant octant> std::vector<std::vector<Pixel>> findEdgePixelsInOctant(const std::vector<Pixel>& startPoints, const SweepAngle& angle) const;		   // Edge pixel detection on the diagonal sweep lines of a whole degree angle.
+	std::vector<std::vector<Pixel>> findEdgePixelsWithBuckets(const bool vertical) const;																													   // Edge-event sweep of an axis-aligned angle.
+	std::vector<std::vector<Pixel>> findEdgePixelsWithDiagonalBuckets(const std::vector<Pixel>& startPoints, const double angle) const;									   // Edge-event sweep of a diagonal angle.
+	template <typename LineEdgePixels> std::vector<std::vector<Pixel>> findEdgePixelsInBands(const uint lineCount, const LineEdgePixels& lineEdgePixels) const;		   // Finding the edge pixels of all sweep lines in parallel bands.
+	LineSweeping rotatedShape(const double angle, Pixel& offset) const;																											   // Creating the object with the contour rotated around the middle of the bounding box.
+	void sweepRotatedContour(SweepState& state) const;																														   // Sweeping the rotated object row by row.
+	void buildChainsIteratively(SweepState& state, const std::vector<Pixel>& edgePixels) const;																					   // Iterative chain building.
+	void startChain(SweepState& state, const Pixel& pixel) const;																														   // Starting a new chain at the given pixel.
+	bool isEdgePixelInVicinity(const uint vicinity, const Pixel& currentPixel, const Pixel& targetPixel) const;																		   // Checking whether a target pixel is in the vicinity of the current pixel on the object edge.
+	static bool isOnDirectionRay(const uint steps, const int deltaX, const int deltaY, const short direction);																	   // Checking whether a pixel offset is reached in less than the given number of moves in a direction.
 
 public:
 	// PLOT METHODS
@@ -54,11 +121,22 @@ public:
 	bool isChainCodeSet() const;							  // Returning true if a chain code is set.
 	void clearSegments();									  // Clearing previous segments.
 	void setAngleOfRotation(const double angle);			  // Setting the angle of rotation (given in radians).
+	void setSweepEngine(const SweepEngine engine);			  // Setting the sweep engine.
+	void setFillEngine(const FillEngine engine);			  // Setting the fill engine.
+	void setLineTraversal(const LineTraversal traversal);	  // Setting the traversal of diagonal sweep lines.
+	void setSweepMode(const SweepMode mode);				  // Setting the sweep mode.
+	void setSweepBandCount(const uint bandCount);			  // Setting the number of bands of sweep lines (at least one).
+	void setChainStorage(const ChainStorage storage);		  // Setting the storage of the pixels of new chains.
 
 	// PUBLIC METHODS
 	bool readFileF8(std::string file, const uint rotation, const uint scale);		// Reading an F4 chain code file.
+	bool readFileF8(const std::string& file, const uint rotation, const uint scale, ParseError& error);  // Reading an F4 chain code file with the description of a potential error.
+	bool readContainerObject(const ChainCodeContainer& container, const uint index, const uint rotation, const uint scale, ParseError& error);  // Reading an object from a chain code container.
 	void fillShape();												// Filling the loaded shape.
 	void sweep();													// Sweeping the object.
+	void sweep(SweepState& state) const;							// Sweeping the filled object with the given state (the object itself is not modified).
+	std::vector<Pixel> diagonalStartPoints(const double angle) const;  // Start points of the diagonal sweep lines of an angle in the sweep order.
+	std::vector<Pixel> diagonalEndPoints(const std::vector<Pixel>& startPoints, const double angle) const;  // End points of the diagonal sweep lines from the given start points.
 };
 
-FeatureVector calculateFeatureVector(const std::vector<LineSweeping>& sweepVector);
\ No newline at end of file
+FeatureVector calculateFeatureVector(const std::vector<std::vector<Chain>>& angleChains);
\ No newline at end of file
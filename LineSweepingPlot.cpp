@@ -0,0 +1,111 @@
+#include "LineSweeping.hpp"
+#include "stdafx.h"
+
+
+// PRIVATE HELPER METHODS
+// Filling a rectangle at X and Y coordinates.
+void LineSweeping::fillRectangle(wxDC& dc, const int x, const int y, const int pixelSize, const int maxCoordinate, const wxPen& pen, const wxBrush& brush, const double ratio) const {
+	// Creating a wxPoint for rendering.
+	wxPoint P[4] = {
+		wxPoint(static_cast<int>(x * ratio), static_cast<int>((maxCoordinate - y) * ratio)),
+		wxPoint(static_cast<int>(x * ratio + pixelSize), static_cast<int>((maxCoordinate - y) * ratio)),
+		wxPoint(static_cast<int>(x * ratio + pixelSize), static_cast<int>((maxCoordinate - y) * ratio + pixelSize)),
+		wxPoint(static_cast<int>(x * ratio), static_cast<int>((maxCoordinate - y) * ratio + pixelSize))
+	};
+
+	// Drawing the point.
+	dc.SetPen(pen);
+	dc.SetBrush(brush);
+	dc.DrawPolygon(4, P);
+
+	// Resetting the pen and the brush.
+	dc.SetPen(*wxBLACK_PEN);
+	dc.SetBrush(*wxWHITE_BRUSH);
+}
+
+
+
+// PLOT METHODS
+// Plotting the F4 chain code as an image.
+void LineSweeping::plotInput(wxDC& dc) const {
+	// Setting the color to green.
+	const wxPen pen(*wxBLACK_PEN);
+	const wxBrush brush(*wxBLACK_BRUSH);
+
+	// Plotting each point as a pixel.
+	for (const RasterPixel& point : coordinates) {
+		fillRectangle(dc, point.x, point.y, 1, maxCoordinate, pen, brush, plotRatio);
+	}
+}
+
+// Plotting the object bounding box.
+void LineSweeping::plotBoundingBox(wxDC& dc) const {
+	// Plotting the four lines of the bounding box.
+	dc.DrawLine(0, 0, static_cast<int>(maxCoordinate * plotRatio), 0);
+	dc.DrawLine(static_cast<int>(maxCoordinate * plotRatio), 0, static_cast<int>(maxCoordinate * plotRatio), static_cast<int>(maxCoordinate * plotRatio));
+	dc.DrawLine(static_cast<int>(maxCoordinate * plotRatio), static_cast<int>(maxCoordinate * plotRatio), 0, static_cast<int>(maxCoordinate * plotRatio));
+	dc.DrawLine(0, static_cast<int>(maxCoordinate * plotRatio), 0, 0);
+}
+
+// Plotting the Bresenham line.
+void LineSweeping::plotBresenhamLine(wxDC& dc, const std::vector<Pixel>& rasterizedLine) const {
+	// Plotting each pixel of the line.
+	for (const Pixel& pixel : rasterizedLine) {
+		fillRectangle(dc, pixel.x, pixel.y, 1, maxCoordinate, *wxLIGHT_GREY_PEN, *wxLIGHT_GREY_BRUSH, plotRatio);
+	}
+}
+
+std::vector<wxColor> colors({
+	wxColor(255,   0,   0),  // Red (0)
+	wxColor(255,   0,   0),  // Red (0)
+	wxColor(255,   0,   0),  // Red (0)
+	wxColor(255,   0,   0),  // Red (0)
+	wxColor(255,   0,   0),  // Red (0)
+	wxColor(255,   0,   0),  // Red (0)
+	wxColor(255,   0,   0),  // Red (0)
+	wxColor(255,   0,   0),  // Red (0)
+	wxColor(255,   0,   0),  // Red (0)
+	wxColor(255,   0,   0),  // Red (0)
+	wxColor(255,   0,   0),  // Red (0)
+	wxColor(255,   0,   0),  // Red (0)
+	wxColor(255,   0,   0),  // Red (0)
+	wxColor(255,   0,   0),  // Red (0)
+	wxColor(255,   0,   0),  // Red (0)
+	wxColor(255,   0,   0),  // Red (0)
+	wxColor(255,   0,   0),  // Red (0)
+	wxColor(255,   0,   0),  // Red (0)
+	wxColor(255,   0,   0),  // Red (0)
+	wxColor(255,   0,   0),  // Red (0)
+	wxColor(255,   0,   0),  // Red (0)
+	wxColor(255,   0,   0),  // Red (0)
+	wxColor(255,   0,   0),  // Red (0)
+	//wxColor(  0,   0, 255),  // Blue (15)
+	//wxColor(34, 139,  34),  // Green (30)
+	//wxColor(255,  0,  255),  // Magenta (45)
+	//wxColor(255, 140,  80),  // Orange (60)
+	//wxColor(0, 0, 0),		// Black (75)
+	//wxColor(76, 0, 153),  // Purple (90)
+
+	//wxColor(255,  0,  255),  // Magenta (105)
+	//wxColor(255, 140,  80),  // Orange (120)
+	//wxColor(0, 0, 0),		// Black (135)
+	//wxColor(76, 0, 153),  // Purple (150)
+	//wxColor(34, 139,  34),  // Green (165)
+
+});
+
+// Plotting the segments.
+void LineSweeping::plotChains(wxDC& dc) const {
+	for (const Chain& chain : chains) {
+		const uint index = static_cast<uint>((chain.angle + 1.0) / 15);
+		dc.SetPen(wxPen(colors[index], 2));
+		
+		if (chain.pixelCount < 10) {
+			continue;
+		}
+
+		for (uint i = 1; i < chain.pixels.size(); i++) {
+			dc.DrawLine(chain.pixels[i - 1].x * plotRatio, (maxCoordinate - chain.pixels[i - 1].y) * plotRatio, chain.pixels[i].x * plotRatio, (maxCoordinate - chain.pixels[i].y) * plotRatio);
+		}
+	}
+}
\ No newline at end of file
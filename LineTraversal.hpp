@@ -0,0 +1,261 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+#include "Pixel.hpp"
+#include "PixelField.hpp"
+
+
+// LINE TRAVERSAL POLICIES
+// Each policy walks the cells of a line segment from left to right (the start point is never to the right of the end point)
+// and calls visitCell(x, y, subPixel) for every cell. subPixel() returns the point of the line in the cell; it is only
+// evaluated on demand, so traversals with exact sub-pixel coordinates do not pay for them in cells that are skipped.
+
+/// <summary>
+/// Integer DDA: one cell per step along the major axis, the minor coordinate is kept as an exact fraction
+/// and truncated towards zero.
+/// </summary>
+struct DdaTraversal {
+	template <typename VisitCell>
+	static void traverse(const Pixel& startPoint, const Pixel& endPoint, VisitCell visitCell) {
+		const int startX = static_cast<int>(startPoint.x);
+		const int startY = static_cast<int>(startPoint.y);
+		const int deltaX = static_cast<int>(endPoint.x) - startX;
+		const int deltaY = static_cast<int>(endPoint.y) - startY;
+
+		// Choosing the octant once per line: the line is walked one pixel at a time along its major axis,
+		// while the minor coordinate of the i-th pixel equals start + i * minorDelta / majorDelta.
+		const bool steep = std::abs(deltaY) > deltaX;
+		const int majorDelta = steep ? std::abs(deltaY) : deltaX;
+		const int minorDelta = steep ? deltaX : deltaY;
+		const int majorStep = steep && deltaY < 0 ? -1 : 1;
+		int major = steep ? startY : startX;
+
+		// The minor coordinate is kept as an exact fraction whole + remainder / majorDelta (0 <= remainder < majorDelta),
+		// so no error accumulates along the line.
+		const int denominator = std::max(majorDelta, 1);
+		int whole = steep ? startX : startY;
+		int remainder = 0;
+
+		for (int i = 0; i <= majorDelta; i++) {
+			// The pixel of the minor coordinate is the truncated coordinate (rounded towards zero).
+			const int minor = whole < 0 && remainder != 0 ? whole + 1 : whole;
+			visitCell(steep ? minor : major, steep ? major : minor, [steep, major, whole, remainder, denominator]() {
+				const double exactMinor = whole + static_cast<double>(remainder) / denominator;
+				return steep ? Pixel(exactMinor, major) : Pixel(major, exactMinor);
+			});
+
+			// Moving to the next pixel (the minor delta is never larger than the major one, so a single carry is enough).
+			major += majorStep;
+			remainder += minorDelta;
+			if (remainder >= denominator) {
+				remainder -= denominator;
+				whole++;
+			}
+			else if (remainder < 0) {
+				remainder += denominator;
+				whole--;
+			}
+		}
+	}
+};
+
+/// <summary>
+/// Integer DDA for lines of a known octant: steepness and the direction of the minor (shallow) or major (steep) axis
+/// are template parameters, so the step of every pixel compiles without any of these decisions.
+/// Lines outside of the octant (short lines at the corners of the bounding box) fall back to DdaTraversal.
+/// </summary>
+template <bool steep, bool ascending>
+struct DdaOctantTraversal {
+	template <typename VisitCell>
+	static void traverse(const Pixel& startPoint, const Pixel& endPoint, VisitCell visitCell) {
+		const int startX = static_cast<int>(startPoint.x);
+		const int startY = static_cast<int>(startPoint.y);
+		const int deltaX = static_cast<int>(endPoint.x) - startX;
+		const int deltaY = static_cast<int>(endPoint.y) - startY;
+
+		const bool isInOctant = steep ?
+			std::abs(deltaY) > deltaX && (ascending ? deltaY > 0 : deltaY < 0) :
+			std::abs(deltaY) <= deltaX && (ascending ? deltaY >= 0 : deltaY <= 0);
+		if (!isInOctant) {
+			DdaTraversal::traverse(startPoint, endPoint, visitCell);
+			return;
+		}
+
+		// The same walk as DdaTraversal: the minor coordinate is kept as an exact fraction whole + remainder / majorDelta.
+		const int majorDelta = steep ? std::abs(deltaY) : deltaX;
+		const int minorDelta = steep ? deltaX : deltaY;
+		constexpr int majorStep = steep && !ascending ? -1 : 1;
+		const int denominator = std::max(majorDelta, 1);
+		int major = steep ? startY : startX;
+		int whole = steep ? startX : startY;
+		int remainder = 0;
+
+		for (int i = 0; i <= majorDelta; i++) {
+			// The pixel of the minor coordinate is the truncated coordinate (rounded towards zero).
+			const int minor = whole < 0 && remainder != 0 ? whole + 1 : whole;
+			visitCell(steep ? minor : major, steep ? major : minor, [major, whole, remainder, denominator]() {
+				const double exactMinor = whole + static_cast<double>(remainder) / denominator;
+				return steep ? Pixel(exactMinor, major) : Pixel(major, exactMinor);
+			});
+
+			// Moving to the next pixel (the minor coordinate only moves in one direction in the octant).
+			major += majorStep;
+			remainder += minorDelta;
+			if (steep || ascending) {
+				if (remainder >= denominator) {
+					remainder -= denominator;
+					whole++;
+				}
+			}
+			else if (remainder < 0) {
+				remainder += denominator;
+				whole--;
+			}
+		}
+	}
+};
+
+/// <summary>
+/// Bresenham algorithm: one cell per step along the major axis, the minor coordinate is rounded to the nearest cell.
+/// </summary>
+struct BresenhamTraversal {
+	template <typename VisitCell>
+	static void traverse(const Pixel& startPoint, const Pixel& endPoint, VisitCell visitCell) {
+		// Calculating the difference between the both coordinates.
+		const int deltaX = static_cast<int>(endPoint.x) - static_cast<int>(startPoint.x);
+		const int deltaY = static_cast<int>(endPoint.y) - static_cast<int>(startPoint.y);
+		const int signY = deltaY >= 0 ? 1 : -1;
+
+		// Helper values for coordinate calculation.
+		const int ax = 2 * deltaX;
+		const int ay = 2 * std::abs(deltaY);
+
+		// Starting X and Y coordinates.
+		int x = static_cast<int>(startPoint.x);
+		int y = static_cast<int>(startPoint.y);
+
+		if (ax >= ay) {
+			int error = ay - (ax / 2);
+
+			for (int i = 0; i <= deltaX; i++) {
+				visitCell(x, y, [x, y]() { return Pixel(x, y); });
+
+				// Adding the correct values to X and Y coordinates.
+				if (error >= 0) {
+					error -= ax;
+					y += signY;
+				}
+
+				error += ay;
+				x++;
+			}
+		}
+		else {
+			int error = ax - (ay / 2);
+
+			for (int i = 0; i <= std::abs(deltaY); i++) {
+				visitCell(x, y, [x, y]() { return Pixel(x, y); });
+
+				// Adding the correct values to X and Y coordinates.
+				if (error > 0) {
+					error -= ay;
+					x++;
+				}
+
+				error += ax;
+				y += signY;
+			}
+		}
+	}
+};
+
+/// <summary>
+/// Cleary-Wyvill algorithm: every cell the line passes through is visited (4-connected), the next step
+/// crosses whichever of the vertical or horizontal cell borders comes first along the line.
+/// </summary>
+struct ClearyWyvillTraversal {
+	template <typename VisitCell>
+	static void traverse(const Pixel& startPoint, const Pixel& endPoint, VisitCell visitCell) {
+		const int endX = static_cast<int>(endPoint.x);
+		const int endY = static_cast<int>(endPoint.y);
+		int x = static_cast<int>(startPoint.x);
+		int y = static_cast<int>(startPoint.y);
+		const int signY = endY >= y ? 1 : -1;
+
+		// Distances along the line (of unit length) between two crossings of vertical and of horizontal cell borders.
+		const double deltaX = endX != x ? 1.0 / (endX - x) : std::numeric_limits<double>::infinity();
+		const double deltaY = endY != y ? 1.0 / std::abs(endY - y) : std::numeric_limits<double>::infinity();
+		double dX = deltaX;
+		double dY = deltaY;
+
+		visitCell(x, y, [x, y]() { return Pixel(x, y); });
+
+		// The line ends in the cell of the end point, so each coordinate stops moving once it reaches it.
+		while (x != endX || y != endY) {
+			if (x != endX && (y == endY || dX <= dY)) {
+				x++;
+				dX += deltaX;
+			}
+			else {
+				y += signY;
+				dY += deltaY;
+			}
+
+			visitCell(x, y, [x, y]() { return Pixel(x, y); });
+		}
+	}
+};
+
+
+/// <summary>
+/// Rasterization of a line segment with the given traversal (cells outside of the pixel field are skipped).
+/// </summary>
+/// <param name="startPoint">: start pixel of the line segment</param>
+/// <param name="endPoint">: end pixel of the line segment</param>
+/// <param name="pixelField">: pixel field of the rasterized scene with an object</param>
+/// <returns>list of pixels of the rasterized line segment from left to right</returns>
+template <typename Traversal>
+std::vector<RasterPixel> rasterizeLine(Pixel startPoint, Pixel endPoint, const PixelField& pixelField) {
+	std::vector<RasterPixel> pixels;
+	if (startPoint.x > endPoint.x) {
+		std::swap(startPoint, endPoint);
+	}
+
+	const int size = static_cast<int>(pixelField.size());
+	Traversal::traverse(startPoint, endPoint, [&pixels, &pixelField, size](const int x, const int y, const auto&) {
+		if (x >= 0 && x < size && y >= 0 && y < size) {
+			pixels.push_back(pixelField.pixel(x, y));
+		}
+	});
+
+	return pixels;
+}
+
+/// <summary>
+/// Edge pixel detection along a line segment with the given traversal (cells outside of the pixel field are skipped).
+/// </summary>
+/// <param name="startPoint">: start pixel of the line segment</param>
+/// <param name="endPoint">: end pixel of the line segment</param>
+/// <param name="pixelField">: pixel field of the rasterized scene with an object</param>
+/// <returns>list of edge pixels from left to right (at the points of the line in their cells)</returns>
+template <typename Traversal>
+std::vector<Pixel> findEdgePixelsAlongLine(Pixel startPoint, Pixel endPoint, const PixelField& pixelField) {
+	std::vector<Pixel> pixels;
+	if (startPoint.x > endPoint.x) {
+		std::swap(startPoint, endPoint);
+	}
+
+	const int size = static_cast<int>(pixelField.size());
+	Traversal::traverse(startPoint, endPoint, [&pixels, &pixelField, size](const int x, const int y, const auto& subPixel) {
+		if (x >= 0 && x < size && y >= 0 && y < size && pixelField.position(x, y) == Position::edge) {
+			const Pixel point = subPixel();
+			pixels.push_back(Pixel(point.x, point.y, Position::edge, pixelField.directionPrevious(x, y), pixelField.directionNext(x, y)));
+		}
+	});
+
+	return pixels;
+}
\ No newline at end of file
@@ -6,6 +6,7 @@
 
 #include "HelperFunctions.hpp"
 #include "MainWindow.hpp"
+#include "MultiSweep.hpp"
 
 
 MainWindow::MainWindow() : 
@@ -18,6 +19,7 @@ MainWindow::MainWindow() :
 	// Creating an image panel.
 	image = new GUI::wxImagePanel(this);
 	sweep.setDrawPanel(image);
+	sweep.setChainStorage(ChainStorage::allPixels);  // The chains are plotted, so all of their pixels are kept.
 
 	/* GENERATED CODE 
 	** DO NOT TOUCH!!!
@@ -215,13 +217,19 @@ void MainWindow::selectChainCode(wxCommandEvent& event) {
 }
 
 void MainWindow::loadF8(wxCommandEvent& event) {
-	//findEdgePixelsWithBresenham(Pixel(0, 10), Pixel(5, 0), PixelField(50, std::vector<Pixel>(50)));
+	//findEdgePixelsWithBresenham(Pixel(0, 10), Pixel(5, 0), PixelField(50));
 
 	// Reading a file with the F8 chain code.
 	std::string file = tbxChainCodeLoading->GetValue().ToStdString();
 	const uint rotation = sbxChainCodeLoadingRotation->GetValue();
 	const uint scale = sbxChainCodeLoadingScale->GetValue();
-	const bool success = sweep.readFileF8(file, rotation, scale);
+	ParseError error;
+	const bool success = sweep.readFileF8(file, rotation, scale, error);
+
+	// If the file cannot be read, the user is told where the problem is.
+	if (!success) {
+		wxMessageBox(error.toString(), "Warning", wxOK | wxICON_WARNING);
+	}
 
 	// Converting the F8 chain code to coordinates and drawing it on the image panel.
 	image->clearAllFlags();
@@ -239,46 +247,27 @@ void MainWindow::multiSweep(wxCommandEvent& event) {
 	}
 
 	// Sweeping the object.
-	std::vector<LineSweeping> sweepVector(50);
-	std::vector<LineSweeping> sweeps(12, sweep);
-
 	auto start = std::chrono::steady_clock::now();
-	for (uint i = 0; i < sweeps.size(); i++) {
-		sweeps[i].clearSegments();				      // Clearing potential previously calculated segments.
-		sweeps[i].fillShape();						  // Filling the object.
-	}
-	auto endFill = std::chrono::steady_clock::now();
-	
-	const uint startAngle = 0;
-	const uint finalAngle = 180;
-	const uint step = 15;
-
-	#pragma omp parallel for
-	for (int i = startAngle; i < finalAngle; i += step) {
-		const uint index = static_cast<uint>(i / step);
-		sweeps[index].setAngleOfRotation(toRadians(i));
-		sweeps[index].sweep();
-		sweepVector[index] = sweeps[index];
-	}
-
+	const MultiSweepResult result = ::multiSweep(sweep);
+	const std::vector<std::vector<Chain>>& angleChains = result.chains;
 
 	const std::string filename = tbxMultisweepOutput->GetValue().ToStdString();
-	FeatureVector featureVector = calculateFeatureVector(sweepVector);  // Calculation of a feature vector for the current object.
+	FeatureVector featureVector = calculateFeatureVector(angleChains);  // Calculation of a feature vector for the current object.
 	featureVector.writeToFile(filename + ".txt", "./Results/");
 
 	auto end = std::chrono::steady_clock::now();
 
-	for (uint i = 0; i < sweepVector.size(); i++) {
-		for (uint j = 0; j < sweepVector[i].chains.size(); j++) {
-			sweep.chains.push_back(sweepVector[i].chains[j]);
+	for (uint i = 0; i < angleChains.size(); i++) {
+		for (uint j = 0; j < angleChains[i].size(); j++) {
+			sweep.chains.push_back(angleChains[i][j]);
 		}
 	}
 
 	image->setSegmentFlag();
 	image->Refresh(false);
 
-	u128 timeFill = std::chrono::duration_cast<std::chrono::milliseconds>(endFill - start).count();
-	u128 timeOther = std::chrono::duration_cast<std::chrono::milliseconds>(end - endFill).count();
+	u128 timeFill = result.timeFill;
+	u128 timeOther = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() - timeFill;
 	u128 time = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
 	std::stringstream ss;
 	ss << "Time (fill): " << timeFill << " ms\n";
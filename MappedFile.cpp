@@ -0,0 +1,107 @@
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "MappedFile.hpp"
+
+
+#ifdef _WIN32
+MappedFile::MappedFile(const std::string& file) {
+	const HANDLE handle = CreateFileA(file.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (handle == INVALID_HANDLE_VALUE) {
+		return;
+	}
+	fileHandle = handle;
+
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(handle, &size)) {
+		close();
+		return;
+	}
+
+	// An empty file cannot be mapped, but it is still a valid (empty) file.
+	open = true;
+	if (size.QuadPart == 0) {
+		return;
+	}
+
+	mappingHandle = CreateFileMappingA(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	const void* view = mappingHandle ? MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0) : nullptr;
+	if (!view) {
+		close();
+		return;
+	}
+
+	contents = static_cast<const char*>(view);
+	contentSize = static_cast<size_t>(size.QuadPart);
+}
+
+void MappedFile::close() {
+	if (contents) {
+		UnmapViewOfFile(contents);
+	}
+	if (mappingHandle) {
+		CloseHandle(mappingHandle);
+	}
+	if (fileHandle) {
+		CloseHandle(fileHandle);
+	}
+
+	contents = nullptr;
+	contentSize = 0;
+	mappingHandle = nullptr;
+	fileHandle = nullptr;
+	open = false;
+}
+#else
+MappedFile::MappedFile(const std::string& file) {
+	const int descriptor = ::open(file.c_str(), O_RDONLY);
+	if (descriptor < 0) {
+		return;
+	}
+
+	struct stat status;
+	if (fstat(descriptor, &status) != 0 || !S_ISREG(status.st_mode)) {
+		::close(descriptor);
+		return;
+	}
+
+	// An empty file cannot be mapped, but it is still a valid (empty) file.
+	open = true;
+	if (status.st_size > 0) {
+		void* view = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+		if (view == MAP_FAILED) {
+			open = false;
+		}
+		else {
+			madvise(view, static_cast<size_t>(status.st_size), MADV_SEQUENTIAL);
+			contents = static_cast<const char*>(view);
+			contentSize = static_cast<size_t>(status.st_size);
+		}
+	}
+
+	// The mapping stays valid after the file descriptor is closed.
+	::close(descriptor);
+}
+
+void MappedFile::close() {
+	if (contents) {
+		munmap(const_cast<char*>(contents), contentSize);
+	}
+
+	contents = nullptr;
+	contentSize = 0;
+	open = false;
+}
+#endif
+
+MappedFile::~MappedFile() {
+	close();
+}
\ No newline at end of file
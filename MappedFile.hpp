@@ -0,0 +1,49 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+
+/// <summary>
+/// Read-only memory mapping of a whole file. The contents stay valid as long as the object exists.
+/// </summary>
+class MappedFile {
+private:
+	const char* contents = nullptr;  // First byte of the mapped file.
+	size_t contentSize = 0;			 // Size of the file in bytes.
+	bool open = false;				 // True if the file has been opened.
+
+#ifdef _WIN32
+	void* fileHandle = nullptr;		 // Handle of the opened file.
+	void* mappingHandle = nullptr;	 // Handle of the file mapping.
+#endif
+
+	// Unmapping and closing the file.
+	void close();
+
+public:
+	/// <summary>
+	/// Constructor that maps the whole file into memory.
+	/// </summary>
+	/// <param name="file">: path to the file</param>
+	MappedFile(const std::string& file);
+
+	/// <summary>
+	/// Destructor that unmaps the file.
+	/// </summary>
+	~MappedFile();
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+
+	// Returning true if the file has been opened (an empty file is open but has no contents).
+	bool isOpen() const {
+		return open;
+	}
+
+	// Contents of the file.
+	std::string_view text() const {
+		return std::string_view(contents, contentSize);
+	}
+};
\ No newline at end of file
@@ -0,0 +1,86 @@
+#include <chrono>
+#include <iostream>
+#include <string>
+
+#include "FeatureMatcher.hpp"
+#include "FeatureStore.hpp"
+#include "FeatureVector.hpp"
+#include "VantagePointTree.hpp"
+
+
+/// <summary>
+/// Comparison of a feature vector against all objects of a feature store. If a neighbour count is given, the closest objects
+/// are found with a vantage-point tree instead (read from <feature store>.vpt, or built and written there if it is missing or the store was rewritten since).
+/// Usage: ObjectCategorizationMatch <feature store> <feature vector file> [neighbour count]
+/// </summary>
+int main(int argc, char* argv[]) {
+	// Without a feature store and a feature vector, we only print the usage.
+	if (argc < 3) {
+		std::cerr << "Usage: " << argv[0] << " <feature store> <feature vector file> [neighbour count]\n";
+		return 1;
+	}
+
+	FeatureStore store;
+	ParseError error;
+	if (!store.open(argv[1], error)) {
+		std::cerr << "Feature store " << argv[1] << " could not be read (" << error.toString() << ").\n";
+		return 1;
+	}
+
+	FeatureVector query;
+	if (!query.readFromFile(argv[2])) {
+		std::cerr << "Feature vector " << argv[2] << " could not be read.\n";
+		return 1;
+	}
+
+	// Finding the closest objects with the vantage-point tree of the feature store.
+	if (argc > 3) {
+		uint k = 0;
+		try {
+			k = static_cast<uint>(std::stoul(argv[3]));
+		}
+		catch (const std::exception&) {
+			std::cerr << "Neighbour count must be a non-negative integer.\n";
+			return 1;
+		}
+
+		const std::string treeFile = std::string(argv[1]) + ".vpt";
+		VantagePointTree tree;
+		if (!tree.read(treeFile, store, error)) {
+			tree.build(store);
+			if (!tree.write(treeFile)) {
+				std::cerr << "Vantage-point tree could not be written to " << treeFile << ".\n";
+			}
+		}
+
+		const std::vector<float> values(query.chainLengths.begin(), query.chainLengths.end());
+		auto start = std::chrono::steady_clock::now();
+		const std::vector<Neighbour> neighbours = tree.nearest(values, k);
+		auto end = std::chrono::steady_clock::now();
+
+		for (const Neighbour& neighbour : neighbours) {
+			std::cout << store.label(neighbour.index) << ": " << neighbour.distance << "\n";
+		}
+
+		const u128 time = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+		std::cout << "Time: " << time << " us\n";
+
+		return neighbours.empty() ? 1 : 0;
+	}
+
+	const FeatureMatcher matcher(store);
+
+	auto start = std::chrono::steady_clock::now();
+	const std::vector<std::string_view> matches = matcher.match(query);
+	auto end = std::chrono::steady_clock::now();
+
+	for (const std::string_view label : matches) {
+		std::cout << label << "\n";
+	}
+
+	const u128 time = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+	std::cout << "Matches: " << matches.size() << "/" << matcher.size() << "\n";
+	std::cout << "Time: " << time << " us\n";
+
+	return matches.empty() ? 1 : 0;
+}
\ No newline at end of file
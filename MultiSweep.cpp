@@ -0,0 +1,92 @@
+#include <chrono>
+#include <utility>
+
+#include "HelperFunctions.hpp"
+#include "MultiSweep.hpp"
+
+
+MultiSweepResult multiSweep(const LineSweeping& sweep) {
+	MultiSweepResult result;
+
+	// The sweep angles are run as tasks of a new parallel region.
+	#pragma omp parallel
+	#pragma omp single
+	result = multiSweepTasks(sweep);
+
+	return result;
+}
+
+MultiSweepResult multiSweepTasks(const LineSweeping& sweep) {
+	MultiSweepResult result;
+
+	const uint angleCount = (MULTISWEEP_FINAL_ANGLE - MULTISWEEP_START_ANGLE) / MULTISWEEP_STEP;
+	result.chains = std::vector<std::vector<Chain>>(angleCount);
+
+	// The object is filled only once (on a single copy without any previously calculated segments).
+	auto start = std::chrono::steady_clock::now();
+	LineSweeping shape = sweep;
+	shape.clearSegments();
+	shape.fillShape();
+	auto endFill = std::chrono::steady_clock::now();
+
+	// Each sweep angle is a task that only reads the shared object and returns its own chains.
+	// While waiting for the angles, the thread takes over other tasks (angles of any object).
+	for (int i = MULTISWEEP_START_ANGLE; i < static_cast<int>(MULTISWEEP_FINAL_ANGLE); i += MULTISWEEP_STEP) {
+		#pragma omp task firstprivate(i) shared(shape, result)
+		{
+			const uint index = static_cast<uint>((i - MULTISWEEP_START_ANGLE) / MULTISWEEP_STEP);
+			SweepState state(toRadians(i));
+			shape.sweep(state);
+			result.chains[index] = std::move(state.chains);
+		}
+	}
+	#pragma omp taskwait
+	auto end = std::chrono::steady_clock::now();
+
+	result.timeFill = std::chrono::duration_cast<std::chrono::milliseconds>(endFill - start).count();
+	result.timeSweep = std::chrono::duration_cast<std::chrono::milliseconds>(end - endFill).count();
+
+	return result;
+}
+
+bool categorizeContainerObject(const ChainCodeContainer& container, const uint index, const uint rotation, const uint scale, const SweepSettings& settings, FeatureVector& featureVector, std::string& error) {
+	// If the object cannot be read, there is nothing to categorize.
+	LineSweeping sweep;
+	ParseError parseError;
+	if (!sweep.readContainerObject(container, index, rotation, scale, parseError)) {
+		error = parseError.toString();
+		return false;
+	}
+	if (!sweep.isChainCodeSet()) {
+		error = "no chain codes";
+		return false;
+	}
+	sweep.setSweepBandCount(settings.bandCount);
+	sweep.setSweepMode(settings.mode);
+
+	const MultiSweepResult result = multiSweepTasks(sweep);
+	featureVector = calculateFeatureVector(result.chains);
+
+	return true;
+}
+
+bool categorizeFile(const std::string& file, const uint rotation, const uint scale, const SweepSettings& settings, FeatureVector& featureVector, std::string& error) {
+	// If the file cannot be read, there is nothing to categorize.
+	LineSweeping sweep;
+	ParseError parseError;
+	if (!sweep.readFileF8(file, rotation, scale, parseError)) {
+		error = parseError.toString();
+		return false;
+	}
+	if (!sweep.isChainCodeSet()) {
+		error = "no chain codes";
+		return false;
+	}
+	sweep.setSweepBandCount(settings.bandCount);
+	sweep.setSweepMode(settings.mode);
+
+	const MultiSweepResult result = multiSweepTasks(sweep);
+	featureVector = calculateFeatureVector(result.chains);
+
+	return true;
+}
\ No newline at end of file
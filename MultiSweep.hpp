@@ -0,0 +1,79 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Chain.hpp"
+#include "ChainCodeContainer.hpp"
+#include "Constants.hpp"
+#include "FeatureVector.hpp"
+#include "LineSweeping.hpp"
+
+
+// CONSTANTS
+const uint MULTISWEEP_START_ANGLE = 0;    // First sweep angle of the multi-sweep (in degrees).
+const uint MULTISWEEP_FINAL_ANGLE = 180;  // Sweep angle where the multi-sweep stops (in degrees, exclusive).
+const uint MULTISWEEP_STEP = 15;          // Step between two sweep angles (in degrees).
+
+
+/// <summary>
+/// Structure with the results of the multi-sweep algorithm.
+/// </summary>
+struct MultiSweepResult {
+	std::vector<std::vector<Chain>> chains;  // Chains of each sweep angle.
+	u128 timeFill = 0;						 // Time spent for filling the object (in ms).
+	u128 timeSweep = 0;						 // Time spent for sweeping the object (in ms).
+};
+
+
+/// <summary>
+/// Settings of the line sweeping objects created by the categorization functions.
+/// </summary>
+struct SweepSettings {
+	uint bandCount = 0;  // Number of bands the sweep lines of one angle are split into (0 lets the batch scheduler choose, see scheduledBandCount).
+	SweepMode mode = SweepMode::sweepLines;  // Mode of sweeping the angles other than 0 degrees (see LineSweeping::setSweepMode).
+};
+
+
+/// <summary>
+/// Multi-sweep algorithm: the loaded object is filled once and swept at every angle of the multi-sweep.
+/// All angles share the filled object, only their sweep states are separate.
+/// </summary>
+/// <param name="sweep">: line sweeping object with a loaded chain code</param>
+/// <returns>chains of each angle with the timings</returns>
+MultiSweepResult multiSweep(const LineSweeping& sweep);
+
+/// <summary>
+/// Multi-sweep algorithm with one task per sweep angle. Inside a parallel region, the angles are
+/// distributed among the threads of the team, otherwise they are swept one after another.
+/// </summary>
+/// <param name="sweep">: line sweeping object with a loaded chain code</param>
+/// <returns>chains of each angle with the timings</returns>
+MultiSweepResult multiSweepTasks(const LineSweeping& sweep);
+
+/// <summary>
+/// Loading an F8 chain code file and calculation of its feature vector with the multi-sweep algorithm.
+/// The sweep angles are tasks, so the function can be called from a task of a parallel region.
+/// </summary>
+/// <param name="file">: path to the chain code file</param>
+/// <param name="rotation">: rotation on the level of the F8 chain code (0-7)</param>
+/// <param name="scale">: scale on the level of the F8 chain code (1-n)</param>
+/// <param name="settings">: settings of the line sweeping</param>
+/// <param name="featureVector">: calculated feature vector (output)</param>
+/// <param name="error">: description of the error if the file cannot be categorized (output)</param>
+/// <returns>true if success, false otherwise</returns>
+bool categorizeFile(const std::string& file, const uint rotation, const uint scale, const SweepSettings& settings, FeatureVector& featureVector, std::string& error);
+
+/// <summary>
+/// Calculation of the feature vector of an object from a chain code container with the multi-sweep algorithm.
+/// The sweep angles are tasks, so the function can be called from a task of a parallel region.
+/// </summary>
+/// <param name="container">: opened chain code container</param>
+/// <param name="index">: index of the object in the container</param>
+/// <param name="rotation">: rotation on the level of the F8 chain code (0-7)</param>
+/// <param name="scale">: scale on the level of the F8 chain code (1-n)</param>
+/// <param name="settings">: settings of the line sweeping</param>
+/// <param name="featureVector">: calculated feature vector (output)</param>
+/// <param name="error">: description of the error if the object cannot be categorized (output)</param>
+/// <returns>true if success, false otherwise</returns>
+bool categorizeContainerObject(const ChainCodeContainer& container, const uint index, const uint rotation, const uint scale, const SweepSettings& settings, FeatureVector& featureVector, std::string& error);
\ No newline at end of file
@@ -19,6 +19,14 @@ Pixel::Pixel(const double x, const double y, const Position& position, const sho
 	directionNext(directionNext)
 {}
 
+Pixel::Pixel(const RasterPixel& pixel) :
+	x(pixel.x),
+	y(pixel.y),
+	position(pixel.position()),
+	directionPrevious(pixel.directionPrevious()),
+	directionNext(pixel.directionNext())
+{}
+
 
 
 bool Pixel::operator == (const Pixel& pixel) const {
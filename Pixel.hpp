@@ -1,9 +1,10 @@
 #pragma once
 
+#include <cstdint>
 #include <vector>
 
 
-// Position enum class.
+// Position enum class (the values fit into two bits, see PixelCell).
 enum class Position {
 	edge,
 	outside,
@@ -12,7 +13,85 @@ enum class Position {
 };
 
 
-// Point struct.
+// Packing of a position and both chain code directions into a single byte.
+// Bits 0-1 hold the position, bits 2-4 the previous and bits 5-7 the next direction.
+// Directions are only kept for edge cells; other cells report -1.
+namespace PixelCell {
+	constexpr uint8_t POSITION_MASK = 0b00000011;
+	constexpr uint8_t DIRECTION_MASK = 0b00000111;
+	constexpr uint8_t PREVIOUS_SHIFT = 2;
+	constexpr uint8_t NEXT_SHIFT = 5;
+
+	// Packing a cell.
+	constexpr uint8_t pack(const Position position, const short directionPrevious = -1, const short directionNext = -1) {
+		return static_cast<uint8_t>(
+			static_cast<uint8_t>(position) |
+			((directionPrevious & DIRECTION_MASK) << PREVIOUS_SHIFT) |
+			((directionNext & DIRECTION_MASK) << NEXT_SHIFT)
+		);
+	}
+
+	// Position of a cell.
+	constexpr Position position(const uint8_t cell) {
+		return static_cast<Position>(cell & POSITION_MASK);
+	}
+
+	// Changing the position of a cell (directions are kept).
+	constexpr uint8_t withPosition(const uint8_t cell, const Position position) {
+		return static_cast<uint8_t>((cell & ~POSITION_MASK) | static_cast<uint8_t>(position));
+	}
+
+	// Previous chain code direction of a cell (-1 if the cell is not on the edge).
+	constexpr short directionPrevious(const uint8_t cell) {
+		return (cell & POSITION_MASK) == static_cast<uint8_t>(Position::edge) ? static_cast<short>((cell >> PREVIOUS_SHIFT) & DIRECTION_MASK) : -1;
+	}
+
+	// Next chain code direction of a cell (-1 if the cell is not on the edge).
+	constexpr short directionNext(const uint8_t cell) {
+		return (cell & POSITION_MASK) == static_cast<uint8_t>(Position::edge) ? static_cast<short>((cell >> NEXT_SHIFT) & DIRECTION_MASK) : -1;
+	}
+}
+
+
+// Compact pixel on the integer raster (contour pixels and pixels of rasterized lines).
+struct RasterPixel {
+	int x = 0;
+	int y = 0;
+	uint8_t cell = PixelCell::pack(Position::undefined);  // Packed position and chain code directions.
+
+	RasterPixel() = default;
+	RasterPixel(const int x, const int y, const Position position = Position::undefined, const short directionPrevious = -1, const short directionNext = -1) :
+		x(x),
+		y(y),
+		cell(PixelCell::pack(position, directionPrevious, directionNext))
+	{}
+
+	// Creating a pixel from an already packed cell.
+	static RasterPixel fromCell(const int x, const int y, const uint8_t cell) {
+		RasterPixel pixel(x, y);
+		pixel.cell = cell;
+		return pixel;
+	}
+
+	Position position() const {
+		return PixelCell::position(cell);
+	}
+
+	short directionPrevious() const {
+		return PixelCell::directionPrevious(cell);
+	}
+
+	short directionNext() const {
+		return PixelCell::directionNext(cell);
+	}
+
+	bool operator == (const RasterPixel& pixel) const {
+		return x == pixel.x && y == pixel.y;
+	}
+};
+
+
+// Point struct with sub-pixel coordinates (chain midpoints and edge hits of diagonal sweep lines).
 struct Pixel {
 	double x;
 	double y;
@@ -22,6 +101,7 @@ struct Pixel {
 
 	Pixel();
 	Pixel(const double x, const double y, const Position& position = Position::undefined, const short directionPrevious = -1, const short directionNext = -1);
+	Pixel(const RasterPixel& pixel);
 
 	bool operator == (const Pixel& pixel) const;
 	Pixel operator + (const Pixel& pixel) const;
@@ -29,8 +109,3 @@ struct Pixel {
 
 	Pixel floor() const;
 };
-
-
-
-// ALIASES
-using PixelField = std::vector<std::vector<Pixel>>;
\ No newline at end of file
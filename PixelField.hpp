@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Pixel.hpp"
+
+
+/// <summary>
+/// Square raster of the scene with an object. Each cell is packed into a single byte (see PixelCell).
+/// Cells are stored row by row in one contiguous block (index = y * size + x).
+/// </summary>
+class PixelField {
+private:
+	std::vector<uint8_t> cells;  // Packed cells of the raster.
+	size_t fieldSize = 0;		 // Number of cells in a row (and number of rows).
+
+public:
+	/// <summary>
+	/// Default constructor of an empty pixel field.
+	/// </summary>
+	PixelField() = default;
+
+	/// <summary>
+	/// Constructor of a square pixel field with all cells undefined.
+	/// </summary>
+	/// <param name="size">: number of cells in a row (and number of rows)</param>
+	PixelField(const size_t size) :
+		cells(size * size, PixelCell::pack(Position::undefined)),
+		fieldSize(size)
+	{}
+
+
+	// Number of cells in a row (and number of rows).
+	size_t size() const {
+		return fieldSize;
+	}
+
+	// Returning true if the pixel field has no cells.
+	bool empty() const {
+		return fieldSize == 0;
+	}
+
+	// Removing all cells.
+	void clear() {
+		cells.clear();
+		fieldSize = 0;
+	}
+
+	// Packed cell at X and Y coordinates.
+	uint8_t cell(const int x, const int y) const {
+		return cells[y * fieldSize + x];
+	}
+
+	// Packed cells of the row at Y coordinate (for passes over whole rows).
+	uint8_t* row(const int y) {
+		return &cells[y * fieldSize];
+	}
+
+	// Position of the cell at X and Y coordinates.
+	Position position(const int x, const int y) const {
+		return PixelCell::position(cell(x, y));
+	}
+
+	// Setting the position of the cell at X and Y coordinates (chain code directions are kept).
+	void setPosition(const int x, const int y, const Position position) {
+		uint8_t& cell = cells[y * fieldSize + x];
+		cell = PixelCell::withPosition(cell, position);
+	}
+
+	// Previous chain code direction of an edge cell (-1 if the cell is not on the edge).
+	short directionPrevious(const int x, const int y) const {
+		return PixelCell::directionPrevious(cell(x, y));
+	}
+
+	// Next chain code direction of an edge cell (-1 if the cell is not on the edge).
+	short directionNext(const int x, const int y) const {
+		return PixelCell::directionNext(cell(x, y));
+	}
+
+	// Marking the cell at X and Y coordinates as an edge with its chain code directions.
+	void setEdge(const int x, const int y, const short directionPrevious, const short directionNext) {
+		cells[y * fieldSize + x] = PixelCell::pack(Position::edge, directionPrevious, directionNext);
+	}
+
+	// Raster pixel at X and Y coordinates.
+	RasterPixel pixel(const int x, const int y) const {
+		return RasterPixel::fromCell(x, y, cell(x, y));
+	}
+};
\ No newline at end of file
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <array>
+
+#include "Constants.hpp"
+#include "Pixel.hpp"
+
+
+// Octant of a diagonal sweep angle enum class. The name describes the sweep lines walked from left to right
+// (shallow lines move by at most one pixel in Y direction per pixel in X direction, steep ones by more).
+enum class SweepOctant {
+	shallowDown,   // Angles in range (0, 45).
+	diagonalDown,  // Angle of 45.
+	steepDown,	   // Angles in range (45, 90).
+	steepUp,	   // Angles in range (90, 135).
+	diagonalUp,	   // Angle of 135.
+	shallowUp	   // Angles in range (135, 180).
+};
+
+
+/// <summary>
+/// Diagonal sweep angle with the tangents needed for the end points of its sweep lines.
+/// Angles above 90 are reduced by 90 before the tangents are calculated.
+/// </summary>
+struct SweepAngle {
+	uint degrees = 0;				  // Sweep angle in degrees.
+	SweepOctant octant = SweepOctant::shallowDown;  // Octant of the sweep angle.
+	double tangent = 0.0;			  // Tangent of the (reduced) angle.
+	double complementTangent = 0.0;	  // Tangent of 90 minus the (reduced) angle.
+};
+
+
+// Compile-time trigonometry of the sweep angles.
+namespace SweepTrigonometry {
+	constexpr long double PI_LONG = 3.141592653589793238462643383279502884L;
+
+	// Sine of an angle in range [0, PI / 2] (Taylor series).
+	constexpr long double sine(const long double x) {
+		long double term = x;
+		long double sum = x;
+		for (int n = 1; n < 20; n++) {
+			term *= -x * x / ((2 * n) * (2 * n + 1));
+			sum += term;
+		}
+		return sum;
+	}
+
+	// Cosine of an angle in range [0, PI / 2] (Taylor series).
+	constexpr long double cosine(const long double x) {
+		long double term = 1.0L;
+		long double sum = 1.0L;
+		for (int n = 1; n < 20; n++) {
+			term *= -x * x / ((2 * n - 1) * (2 * n));
+			sum += term;
+		}
+		return sum;
+	}
+
+	// Tangent of an angle in range (0, 90).
+	constexpr double tangent(const uint degrees) {
+		const long double x = degrees * PI_LONG / 180;
+		return static_cast<double>(sine(x) / cosine(x));
+	}
+
+	// Octant of a diagonal sweep angle.
+	constexpr SweepOctant octant(const uint degrees) {
+		if (degrees < 45) {
+			return SweepOctant::shallowDown;
+		}
+		else if (degrees == 45) {
+			return SweepOctant::diagonalDown;
+		}
+		else if (degrees < 90) {
+			return SweepOctant::steepDown;
+		}
+		else if (degrees < 135) {
+			return SweepOctant::steepUp;
+		}
+		else if (degrees == 135) {
+			return SweepOctant::diagonalUp;
+		}
+		return SweepOctant::shallowUp;
+	}
+
+	// Sweep angle of a diagonal angle in degrees (0 and 90 have no tangents, since their sweep lines are rows and columns).
+	constexpr SweepAngle sweepAngle(const uint degrees) {
+		const uint reduced = degrees % 90;
+		if (reduced == 0) {
+			return SweepAngle{ degrees, octant(degrees), 0.0, 0.0 };
+		}
+		return SweepAngle{ degrees, octant(degrees), tangent(reduced), tangent(90 - reduced) };
+	}
+}
+
+
+// Sweep angles of all whole degrees in range [0, 180).
+constexpr std::array<SweepAngle, 180> SWEEP_ANGLES = [] {
+	std::array<SweepAngle, 180> angles{};
+	for (uint degrees = 0; degrees < 180; degrees++) {
+		angles[degrees] = SweepTrigonometry::sweepAngle(degrees);
+	}
+	return angles;
+}();
+
+
+/// <summary>
+/// Calculation of the end point of a sweep line for an angle of the given octant (the branches of
+/// getEndPointForBresenham are resolved at compile time and the tangents come from the angle table).
+/// </summary>
+/// <param name="start">: start pixel of the sweep line</param>
+/// <param name="angle">: sweep angle of the octant</param>
+/// <param name="maxCoordinate">: maximum coordinate of the bounding box</param>
+/// <returns>end pixel of the sweep line</returns>
+template <SweepOctant octant>
+Pixel sweepLineEndPoint(const Pixel& start, const SweepAngle& angle, const int maxCoordinate) {
+	if constexpr (octant == SweepOctant::diagonalDown) {
+		return start.y != maxCoordinate ? Pixel(start.y, 0) : Pixel(maxCoordinate, start.x);
+	}
+	else if constexpr (octant == SweepOctant::diagonalUp) {
+		return start.x != maxCoordinate ? Pixel(0, maxCoordinate - start.x) : Pixel(maxCoordinate - start.y, 0);
+	}
+	else if constexpr (octant == SweepOctant::shallowDown) {
+		const int x = static_cast<int>(start.y * angle.complementTangent);
+		if (x < maxCoordinate) {
+			return Pixel(x, 0);
+		}
+		else if (start.y < maxCoordinate) {
+			return Pixel(maxCoordinate, static_cast<int>((x - maxCoordinate) * angle.tangent));
+		}
+		return Pixel(maxCoordinate, static_cast<int>(maxCoordinate - (maxCoordinate - start.x) * angle.tangent));
+	}
+	else if constexpr (octant == SweepOctant::steepDown) {
+		if (start.y < maxCoordinate) {
+			return Pixel(static_cast<int>(start.y * angle.complementTangent), 0);
+		}
+		const int x = static_cast<int>(start.x + maxCoordinate * angle.complementTangent);
+		if (x < maxCoordinate) {
+			return Pixel(x, 0);
+		}
+		return Pixel(maxCoordinate, static_cast<int>(maxCoordinate - (maxCoordinate - start.x) / angle.complementTangent));
+	}
+	else if constexpr (octant == SweepOctant::steepUp) {
+		const int y = static_cast<int>(maxCoordinate - (start.x / angle.tangent));
+		if (y > 0) {
+			return Pixel(0, y);
+		}
+		else if (start.x < maxCoordinate) {
+			return Pixel(static_cast<int>(-y * angle.tangent), 0);
+		}
+		return Pixel(static_cast<int>(maxCoordinate - (start.y / angle.complementTangent)), 0);
+	}
+	else {
+		if (start.x < maxCoordinate) {
+			return Pixel(0, static_cast<int>(maxCoordinate - (start.x / angle.tangent)));
+		}
+		const int y = static_cast<int>(start.y - maxCoordinate * angle.complementTangent);
+		if (y > 0) {
+			return Pixel(0, y);
+		}
+		return Pixel(static_cast<int>(maxCoordinate - (start.y / angle.complementTangent)), 0);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <vector>
+
+#include "Chain.hpp"
+#include "ChainTailGrid.hpp"
+#include "Pixel.hpp"
+
+
+/// <summary>
+/// Mutable state of a single sweep angle. The object (contour and filled raster) is only read
+/// during the sweep, so several angles can share it and each of them only owns its state.
+/// </summary>
+struct SweepState {
+	double sweepAngle = 0.0;						// Sweep line angle of rotation (in radians).
+	std::vector<Pixel> previousEdgePixels;			// Edge pixels of the previous sweep line.
+	std::vector<Pixel> previousActualEdgePixels;	// Edge pixels of the previous sweep line that continue the edge.
+	std::vector<Chain> chains;						// Chains found by the sweep.
+	ChainTailGrid chainTails;						// Grid over the chain tails (only valid during a sweep).
+
+
+	/// <summary>
+	/// Default constructor of an empty state.
+	/// </summary>
+	SweepState() = default;
+
+	/// <summary>
+	/// Constructor of an empty state for the given sweep angle.
+	/// </summary>
+	/// <param name="sweepAngle">: sweep line angle of rotation (in radians)</param>
+	SweepState(const double sweepAngle) :
+		sweepAngle(sweepAngle)
+	{}
+};
\ No newline at end of file
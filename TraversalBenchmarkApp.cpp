@@ -0,0 +1,313 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "BatchCategorization.hpp"
+#include "HelperFunctions.hpp"
+#include "LineSweeping.hpp"
+#include "LineTraversal.hpp"
+#include "MultiSweep.hpp"
+
+
+// CONSTANTS
+const uint RANGE_COUNT = 4;		 // Number of angle ranges (0-45, 45-90, 90-135 and 135-180 degrees).
+const uint TRAVERSAL_COUNT = 4;	 // Number of compared traversals (including the edge-bucket engine).
+const std::array<const char*, TRAVERSAL_COUNT> TRAVERSAL_NAMES = { "DDA", "Bresenham", "Cleary-Wyvill", "Buckets" };
+
+
+/// <summary>
+/// Results of a traversal in an angle range.
+/// </summary>
+struct TraversalStatistics {
+	u128 lines = 0;			 // Number of traversed sweep lines.
+	u128 agreeingLines = 0;	 // Number of sweep lines with the same edge pixels as the DDA traversal.
+	double time = 0.0;		 // Time spent for the traversal (in ms).
+};
+
+
+// Finding the edge pixels of all sweep lines with the given traversal and measuring the time.
+template <typename Traversal>
+std::vector<std::vector<Pixel>> findEdgePixels(const LineSweeping& sweep, const std::vector<Pixel>& startPoints, const double angle, double& time) {
+	std::vector<std::vector<Pixel>> lineEdgePixels(startPoints.size());
+
+	auto start = std::chrono::steady_clock::now();
+	const std::vector<Pixel> endPoints = sweep.diagonalEndPoints(startPoints, angle);
+	for (uint line = 0; line < startPoints.size(); line++) {
+		lineEdgePixels[line] = findEdgePixelsAlongLine<Traversal>(startPoints[line], endPoints[line], sweep.pixelField);
+	}
+	auto end = std::chrono::steady_clock::now();
+
+	time += std::chrono::duration<double, std::milli>(end - start).count();
+	return lineEdgePixels;
+}
+
+// Finding the edge pixels of all sweep lines with the edge-bucket engine (SweepEngine::edgeBuckets) and measuring the time.
+std::vector<std::vector<Pixel>> findEdgePixelsWithBuckets(const LineSweeping& sweep, const std::vector<Pixel>& startPoints, const double angle, double& time) {
+	auto start = std::chrono::steady_clock::now();
+	std::vector<std::vector<Pixel>> lineEdgePixels = sweep.findEdgePixelsWithDiagonalBuckets(startPoints, angle);
+	auto end = std::chrono::steady_clock::now();
+
+	time += std::chrono::duration<double, std::milli>(end - start).count();
+	return lineEdgePixels;
+}
+
+// Returning true if both lines have edge pixels in the same cells.
+bool isSameEdge(const std::vector<Pixel>& pixels1, const std::vector<Pixel>& pixels2) {
+	if (pixels1.size() != pixels2.size()) {
+		return false;
+	}
+
+	for (uint i = 0; i < pixels1.size(); i++) {
+		if (!(pixels1[i].floor() == pixels2[i].floor())) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+// Returning true if both chains have the same pixels, length and angle.
+bool isSameChain(const Chain& chain1, const Chain& chain2) {
+	if (chain1.pixelCount != chain2.pixelCount || chain1.length != chain2.length || chain1.angle != chain2.angle || chain1.pixels.size() != chain2.pixels.size()) {
+		return false;
+	}
+
+	for (uint i = 0; i < chain1.pixels.size(); i++) {
+		if (!(chain1.pixels[i] == chain2.pixels[i])) {
+			return false;
+		}
+	}
+
+	return chain1.firstPixel == chain2.firstPixel && chain1.lastPixel == chain2.lastPixel;
+}
+
+// Returning true if a rotated contour sweep leaves the chains of an earlier sweep at another angle unchanged.
+bool isRotatedSweepIsolated(const std::string& file, const uint scale) {
+	LineSweeping sweep;
+	if (!sweep.readFileF8(file, 0, scale) || !sweep.isChainCodeSet()) {
+		return false;
+	}
+	sweep.setSweepMode(SweepMode::rotatedContour);
+	sweep.setChainStorage(ChainStorage::allPixels);
+	sweep.fillShape();
+
+	sweep.setAngleOfRotation(0.0);
+	sweep.sweep();
+	const std::vector<Chain> chains = sweep.chains;
+
+	sweep.setAngleOfRotation(toRadians(MULTISWEEP_STEP));
+	sweep.sweep();
+
+	if (sweep.chains.size() < chains.size()) {
+		return false;
+	}
+	for (uint i = 0; i < chains.size(); i++) {
+		if (!isSameChain(chains[i], sweep.chains[i])) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+// Largest difference between the feature vectors of a multi-sweep in the rotated contour mode and in the default
+// sweep line mode (missing values of the shorter feature vector count as zero).
+double rotatedFeatureVectorDifference(const std::string& file, const uint scale) {
+	LineSweeping sweep;
+	if (!sweep.readFileF8(file, 0, scale) || !sweep.isChainCodeSet()) {
+		return 0.0;
+	}
+
+	const FeatureVector featureVector = calculateFeatureVector(multiSweep(sweep).chains);
+	sweep.setSweepMode(SweepMode::rotatedContour);
+	const FeatureVector rotatedFeatureVector = calculateFeatureVector(multiSweep(sweep).chains);
+
+	const std::vector<double>& lengths = featureVector.chainLengths;
+	const std::vector<double>& rotatedLengths = rotatedFeatureVector.chainLengths;
+	double difference = 0.0;
+	for (uint i = 0; i < std::max(lengths.size(), rotatedLengths.size()); i++) {
+		const double length = i < lengths.size() ? lengths[i] : 0.0;
+		const double rotatedLength = i < rotatedLengths.size() ? rotatedLengths[i] : 0.0;
+		difference = std::max(difference, std::abs(length - rotatedLength));
+	}
+
+	return difference;
+}
+
+// Returning true if a multi-sweep with changed settings builds the same chains and feature vector as a multi-sweep
+// with the default settings.
+bool isMultiSweepUnchanged(const std::string& file, const uint scale, const std::function<void(LineSweeping&)>& changeSettings) {
+	LineSweeping sweep;
+	if (!sweep.readFileF8(file, 0, scale) || !sweep.isChainCodeSet()) {
+		return false;
+	}
+	sweep.setChainStorage(ChainStorage::allPixels);
+
+	const MultiSweepResult result = multiSweep(sweep);
+	changeSettings(sweep);
+	const MultiSweepResult changedResult = multiSweep(sweep);
+
+	for (uint angle = 0; angle < result.chains.size(); angle++) {
+		if (result.chains[angle].size() != changedResult.chains[angle].size()) {
+			return false;
+		}
+		for (uint i = 0; i < result.chains[angle].size(); i++) {
+			if (!isSameChain(result.chains[angle][i], changedResult.chains[angle][i])) {
+				return false;
+			}
+		}
+	}
+
+	return calculateFeatureVector(result.chains).chainLengths == calculateFeatureVector(changedResult.chains).chainLengths;
+}
+
+
+/// <summary>
+/// Benchmark of the traversals of diagonal sweep lines on all chain code files (*.txt) in a directory.
+/// For every angle range, the throughput and the agreement of the edge pixels with the DDA traversal (the endPoints
+/// engine of the raster sweep) are reported, also for the edge-bucket engine (the default), which only visits the contour
+/// pixels of each line.
+/// It is checked that the edge-bucket engine builds the same chains as the raster engine in every multi-sweep.
+/// It is also checked that a rotated contour sweep does not change the chains of other angles and that splitting
+/// the sweep lines into bands does not change the chains or the feature vector. The feature vectors of the rotated
+/// contour mode are compared with the default sweep line mode (their chains differ, so only the difference is reported).
+/// Usage: ObjectCategorizationTraversalBenchmark [input directory = ./Datasets/] [scale = 1] [bands = 4]
+/// </summary>
+int main(int argc, char* argv[]) {
+	const std::string inputDirectory = argc > 1 ? argv[1] : "./Datasets/";
+	uint scale = 1;
+	uint bandCount = 4;
+
+	try {
+		scale = argc > 2 ? static_cast<uint>(std::stoul(argv[2])) : 1;
+		bandCount = argc > 3 ? static_cast<uint>(std::stoul(argv[3])) : 4;
+	}
+	catch (const std::exception&) {
+		std::cerr << "Scale and band count must be positive integers.\n";
+		return 1;
+	}
+
+	if (scale < 1 || bandCount < 1) {
+		std::cerr << "Scale and band count must be at least 1.\n";
+		return 1;
+	}
+
+	const std::vector<std::string> files = listChainCodeFiles(inputDirectory);
+	if (files.empty()) {
+		std::cerr << "No chain code files found in " << inputDirectory << ".\n";
+		return 1;
+	}
+
+	std::array<std::array<TraversalStatistics, TRAVERSAL_COUNT>, RANGE_COUNT> statistics{};
+	uint isolatedRotatedSweeps = 0;
+	uint sameBandedSweeps = 0;
+	uint sameEngineSweeps = 0;
+	double rotatedDifferenceSum = 0.0;
+	double rotatedDifferenceMax = 0.0;
+	uint sameRotatedFeatureVectors = 0;
+
+	for (const std::string& file : files) {
+		LineSweeping sweep;
+		if (!sweep.readFileF8(file, 0, scale) || !sweep.isChainCodeSet()) {
+			std::cerr << file << ": FAILED\n";
+			continue;
+		}
+		sweep.fillShape();
+
+		if (isRotatedSweepIsolated(file, scale)) {
+			isolatedRotatedSweeps++;
+		}
+		else {
+			std::cerr << file << ": rotated contour sweep changed the chains of another angle\n";
+		}
+
+		const double rotatedDifference = rotatedFeatureVectorDifference(file, scale);
+		rotatedDifferenceSum += rotatedDifference;
+		rotatedDifferenceMax = std::max(rotatedDifferenceMax, rotatedDifference);
+		if (rotatedDifference == 0.0) {
+			sameRotatedFeatureVectors++;
+		}
+
+		if (isMultiSweepUnchanged(file, scale, [](LineSweeping& changedSweep) { changedSweep.setSweepEngine(SweepEngine::raster); })) {
+			sameEngineSweeps++;
+		}
+		else {
+			std::cerr << file << ": sweep with the raster engine built other chains than with the edge-bucket engine\n";
+		}
+
+		if (isMultiSweepUnchanged(file, scale, [bandCount](LineSweeping& changedSweep) { changedSweep.setSweepBandCount(bandCount); })) {
+			sameBandedSweeps++;
+		}
+		else {
+			std::cerr << file << ": sweep with " << bandCount << " bands built other chains than with one band\n";
+		}
+
+		// Only the diagonal angles of the multi-sweep are traversed (axis-aligned ones are scanned row by row).
+		for (uint degrees = MULTISWEEP_START_ANGLE; degrees < MULTISWEEP_FINAL_ANGLE; degrees += MULTISWEEP_STEP) {
+			if (degrees % 90 == 0) {
+				continue;
+			}
+
+			const double angle = toRadians(degrees);
+			const std::vector<Pixel> startPoints = sweep.diagonalStartPoints(angle);
+			std::array<TraversalStatistics, TRAVERSAL_COUNT>& rangeStatistics = statistics[degrees / 45];
+
+			const std::array<std::vector<std::vector<Pixel>>, TRAVERSAL_COUNT> lineEdgePixels = {
+				findEdgePixels<DdaTraversal>(sweep, startPoints, angle, rangeStatistics[0].time),
+				findEdgePixels<BresenhamTraversal>(sweep, startPoints, angle, rangeStatistics[1].time),
+				findEdgePixels<ClearyWyvillTraversal>(sweep, startPoints, angle, rangeStatistics[2].time),
+				findEdgePixelsWithBuckets(sweep, startPoints, angle, rangeStatistics[3].time)
+			};
+
+			for (uint traversal = 0; traversal < TRAVERSAL_COUNT; traversal++) {
+				for (uint line = 0; line < startPoints.size(); line++) {
+					rangeStatistics[traversal].lines++;
+					if (isSameEdge(lineEdgePixels[0][line], lineEdgePixels[traversal][line])) {
+						rangeStatistics[traversal].agreeingLines++;
+					}
+				}
+			}
+		}
+	}
+
+	// Reporting the results of each angle range.
+	std::printf("%-10s %-14s %10s %12s %12s\n", "Angles", "Traversal", "Time [ms]", "Lines/ms", "Agreement");
+	for (uint range = 0; range < RANGE_COUNT; range++) {
+		for (uint traversal = 0; traversal < TRAVERSAL_COUNT; traversal++) {
+			const TraversalStatistics& result = statistics[range][traversal];
+			if (result.lines == 0) {
+				continue;
+			}
+
+			const std::string angles = std::to_string(range * 45) + "-" + std::to_string((range + 1) * 45);
+			std::printf(
+				"%-10s %-14s %10.1f %12.1f %11.2f%%\n",
+				angles.c_str(),
+				TRAVERSAL_NAMES[traversal],
+				result.time,
+				result.time > 0.0 ? result.lines / result.time : 0.0,
+				100.0 * result.agreeingLines / result.lines
+			);
+		}
+	}
+
+	std::printf("\nRotated contour sweeps without changes to other angles: %u/%zu\n", isolatedRotatedSweeps, files.size());
+
+	std::printf(
+		"Feature vector difference of rotated contour sweeps from sweep lines: mean %.4f, max %.4f, identical %u/%zu\n",
+		rotatedDifferenceSum / files.size(),
+		rotatedDifferenceMax,
+		sameRotatedFeatureVectors,
+		files.size()
+	);
+	std::printf("Sweeps with the same chains in the raster and the edge-bucket engine: %u/%zu\n", sameEngineSweeps, files.size());
+	std::printf("Sweeps with %u bands and the same chains as with one band: %u/%zu\n", bandCount, sameBandedSweeps, files.size());
+
+	return isolatedRotatedSweeps == files.size() && sameEngineSweeps == files.size() && sameBandedSweeps == files.size() ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,287 @@
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+#include "ContainerCursor.hpp"
+#include "MappedFile.hpp"
+#include "VantagePointTree.hpp"
+
+
+double featureDistance(const std::span<const float> values1, const std::span<const float> values2) {
+	const size_t commonLength = std::min(values1.size(), values2.size());
+
+	double distance = 0.0;
+	for (size_t i = 0; i < commonLength; i++) {
+		distance = std::max(distance, std::abs(static_cast<double>(values1[i]) - static_cast<double>(values2[i])));
+	}
+
+	// Missing chain lengths of the shorter feature vector are 0.
+	const std::span<const float> longer = values1.size() > values2.size() ? values1 : values2;
+	for (size_t i = commonLength; i < longer.size(); i++) {
+		distance = std::max(distance, std::abs(static_cast<double>(longer[i])));
+	}
+
+	return distance;
+}
+
+
+
+// PRIVATE HELPER METHODS
+// Building the subtree of the objects in the given range and returning the index of its root.
+uint32_t VantagePointTree::buildSubtree(std::vector<std::pair<double, uint32_t>>& objects, const size_t begin, const size_t end) {
+	if (begin == end) {
+		return VANTAGE_POINT_TREE_NONE;
+	}
+
+	const uint32_t index = static_cast<uint32_t>(nodes.size());
+	nodes.push_back(Node());
+
+	// The vantage point is the middle object of the range (the ranges are shuffled once, so it is a random object).
+	std::swap(objects[begin], objects[begin + (end - begin) / 2]);
+	const uint32_t object = objects[begin].second;
+	const std::span<const float> vantagePoint = store->values(object);
+
+	// Splitting the remaining objects by their median distance from the vantage point.
+	for (size_t i = begin + 1; i < end; i++) {
+		objects[i].first = featureDistance(vantagePoint, store->values(objects[i].second));
+	}
+
+	const size_t median = begin + 1 + (end - begin - 1) / 2;
+	if (median < end) {
+		std::nth_element(objects.begin() + begin + 1, objects.begin() + median, objects.begin() + end);
+		nodes[index].threshold = objects[median].first;
+	}
+
+	nodes[index].object = object;
+	const uint32_t inside = buildSubtree(objects, begin + 1, median);
+	const uint32_t outside = buildSubtree(objects, median, end);
+	nodes[index].inside = inside;
+	nodes[index].outside = outside;
+
+	return index;
+}
+
+// Collecting the objects of a subtree within the radius, which shrinks to the farthest neighbour once k neighbours are found.
+void VantagePointTree::search(const uint32_t node, const std::span<const float> query, const size_t k, double& radius, std::vector<Neighbour>& neighbours) const {
+	if (node == VANTAGE_POINT_TREE_NONE) {
+		return;
+	}
+
+	const Node& current = nodes[node];
+	const double distance = featureDistance(query, store->values(current.object));
+
+	// The neighbours are kept as a max-heap, so the farthest of them can be replaced.
+	if (distance <= radius) {
+		neighbours.push_back(Neighbour{ current.object, distance });
+		std::push_heap(neighbours.begin(), neighbours.end());
+
+		if (neighbours.size() > k) {
+			std::pop_heap(neighbours.begin(), neighbours.end());
+			neighbours.pop_back();
+		}
+		if (neighbours.size() == k) {
+			radius = std::min(radius, neighbours.front().distance);
+		}
+	}
+
+	// By the triangle inequality, the inside subtree can only contain objects within the radius if distance - radius <= threshold
+	// and the outside subtree only if distance + radius >= threshold. The subtree on the side of the query is searched first.
+	if (distance < current.threshold) {
+		if (distance - radius <= current.threshold) {
+			search(current.inside, query, k, radius, neighbours);
+		}
+		if (distance + radius >= current.threshold) {
+			search(current.outside, query, k, radius, neighbours);
+		}
+	}
+	else {
+		if (distance + radius >= current.threshold) {
+			search(current.outside, query, k, radius, neighbours);
+		}
+		if (distance - radius <= current.threshold) {
+			search(current.inside, query, k, radius, neighbours);
+		}
+	}
+}
+
+
+
+// PUBLIC METHODS
+void VantagePointTree::build(const FeatureStore& featureStore) {
+	store = &featureStore;
+	storeFingerprint = featureStore.fingerprint();
+	nodes.clear();
+	nodes.reserve(featureStore.size());
+
+	// Shuffling the objects with a fixed permutation, so the vantage points are random but the tree is always the same.
+	std::vector<std::pair<double, uint32_t>> objects(featureStore.size());
+	for (uint32_t i = 0; i < objects.size(); i++) {
+		objects[i] = { 0.0, i };
+	}
+	uint64_t state = 1;
+	for (size_t i = objects.size(); i > 1; i--) {
+		state = state * 6364136223846793005ull + 1442695040888963407ull;
+		std::swap(objects[i - 1], objects[(state >> 33) % i]);
+	}
+
+	buildSubtree(objects, 0, objects.size());
+}
+
+bool VantagePointTree::read(const std::string& path, const FeatureStore& featureStore, ParseError& error) {
+	store = &featureStore;
+	nodes.clear();
+
+	// If the file cannot be opened, we do not panic but abort the process.
+	MappedFile file(path);
+	if (!file.isOpen()) {
+		error.offset = 0;
+		error.message = "file " + path + " cannot be opened";
+		return false;
+	}
+
+	ContainerCursor cursor(file.text(), 0, error);
+	std::string_view magic;
+	uint64_t version = 0;
+	uint64_t fileSize = 0;
+	uint64_t modificationTime = 0;
+	uint64_t objectCount = 0;
+	uint64_t nodeCount = 0;
+	if (!cursor.bytes(VANTAGE_POINT_TREE_MAGIC.size(), magic, "header")) {
+		return false;
+	}
+	if (magic != VANTAGE_POINT_TREE_MAGIC) {
+		return ContainerCursor(file.text(), 0, error).fail("not a vantage-point tree");
+	}
+	if (!cursor.number(4, version, "header")) {
+		return false;
+	}
+	if (version != VANTAGE_POINT_TREE_VERSION) {
+		return ContainerCursor(file.text(), 4, error).fail("unsupported vantage-point tree version " + std::to_string(version));
+	}
+	if (!cursor.number(8, fileSize, "header") || !cursor.number(8, modificationTime, "header") || !cursor.number(4, objectCount, "header") || !cursor.number(4, nodeCount, "header")) {
+		return false;
+	}
+
+	// The tree must be built for this very feature store file and contain each of its objects exactly once.
+	const FeatureStoreFingerprint fingerprint{ fileSize, static_cast<int64_t>(modificationTime) };
+	if (!(fingerprint == featureStore.fingerprint()) || objectCount != featureStore.size() || nodeCount != objectCount) {
+		return ContainerCursor(file.text(), 8, error).fail("the tree does not belong to the feature store");
+	}
+	storeFingerprint = fingerprint;
+
+	// Visited nodes (reached from a parent) and objects, so that no node or object can be used twice.
+	std::vector<bool> reachedNodes(static_cast<size_t>(nodeCount), false);
+	std::vector<bool> seenObjects(static_cast<size_t>(objectCount), false);
+
+	nodes.resize(static_cast<size_t>(nodeCount));
+	for (Node& node : nodes) {
+		uint64_t object = 0;
+		uint64_t inside = 0;
+		uint64_t outside = 0;
+		uint64_t threshold = 0;
+		if (!cursor.number(4, object, "node") || !cursor.number(4, inside, "node") || !cursor.number(4, outside, "node") || !cursor.number(8, threshold, "node")) {
+			nodes.clear();
+			return false;
+		}
+
+		// Children always follow their parent, which also rules out cycles.
+		const uint32_t index = static_cast<uint32_t>(&node - nodes.data());
+		const auto isValidChild = [&](const uint64_t child) { return child == VANTAGE_POINT_TREE_NONE || (child > index && child < nodeCount); };
+		if (object >= objectCount || !isValidChild(inside) || !isValidChild(outside)) {
+			nodes.clear();
+			return cursor.fail("invalid node " + std::to_string(index));
+		}
+
+		// Every node except the root must have been reached from exactly one parent before it is read,
+		// and every object must belong to exactly one node.
+		if (index > 0 && !reachedNodes[index]) {
+			nodes.clear();
+			return cursor.fail("node " + std::to_string(index) + " is not reachable");
+		}
+		if (seenObjects[object]) {
+			nodes.clear();
+			return cursor.fail("object " + std::to_string(object) + " appears twice");
+		}
+		for (const uint64_t child : { inside, outside }) {
+			if (child != VANTAGE_POINT_TREE_NONE && reachedNodes[child]) {
+				nodes.clear();
+				return cursor.fail("node " + std::to_string(child) + " is reached twice");
+			}
+			if (child != VANTAGE_POINT_TREE_NONE) {
+				reachedNodes[child] = true;
+			}
+		}
+		seenObjects[object] = true;
+
+		node.object = static_cast<uint32_t>(object);
+		node.inside = static_cast<uint32_t>(inside);
+		node.outside = static_cast<uint32_t>(outside);
+		node.threshold = std::bit_cast<double>(threshold);
+	}
+
+	return true;
+}
+
+bool VantagePointTree::write(const std::string& path) const {
+	std::ofstream out(path, std::ios::binary | std::ios::trunc);
+
+	// If the file is not open, we return no success.
+	if (!out.is_open()) {
+		return false;
+	}
+
+	const auto writeNumber = [&out](const uint64_t value, const size_t size) {
+		uint8_t bytes[8];
+		for (size_t i = 0; i < size; i++) {
+			bytes[i] = static_cast<uint8_t>(value >> (8 * i));
+		}
+		out.write(reinterpret_cast<const char*>(bytes), static_cast<std::streamsize>(size));
+	};
+
+	out.write(VANTAGE_POINT_TREE_MAGIC.data(), static_cast<std::streamsize>(VANTAGE_POINT_TREE_MAGIC.size()));
+	writeNumber(VANTAGE_POINT_TREE_VERSION, 4);
+	writeNumber(storeFingerprint.fileSize, 8);
+	writeNumber(static_cast<uint64_t>(storeFingerprint.modificationTime), 8);
+	writeNumber(size(), 4);
+	writeNumber(nodes.size(), 4);
+	for (const Node& node : nodes) {
+		writeNumber(node.object, 4);
+		writeNumber(node.inside, 4);
+		writeNumber(node.outside, 4);
+		writeNumber(std::bit_cast<uint64_t>(node.threshold), 8);
+	}
+
+	out.close();
+
+	return !out.fail();
+}
+
+uint VantagePointTree::size() const {
+	return static_cast<uint>(nodes.size());
+}
+
+std::vector<Neighbour> VantagePointTree::nearest(const std::span<const float> query, const uint k) const {
+	std::vector<Neighbour> neighbours;
+	if (k == 0 || nodes.empty()) {
+		return neighbours;
+	}
+
+	double radius = std::numeric_limits<double>::infinity();
+	search(0, query, k, radius, neighbours);
+	std::sort(neighbours.begin(), neighbours.end());
+
+	return neighbours;
+}
+
+std::vector<Neighbour> VantagePointTree::withinRadius(const std::span<const float> query, const double radius) const {
+	std::vector<Neighbour> neighbours;
+	if (nodes.empty()) {
+		return neighbours;
+	}
+
+	double searchRadius = radius;
+	search(0, query, std::numeric_limits<size_t>::max(), searchRadius, neighbours);
+	std::sort(neighbours.begin(), neighbours.end());
+
+	return neighbours;
+}
\ No newline at end of file
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ChainCodeReader.hpp"
+#include "Constants.hpp"
+#include "FeatureStore.hpp"
+
+
+// CONSTANTS
+// Layout of a vantage-point tree file (all numbers are little-endian):
+//   header:  magic "VPT1", uint32 version, uint64 file size and int64 modification time of the feature store,
+//            uint32 object count of the feature store, uint32 node count
+//   nodes:   uint32 object, uint32 inside child, uint32 outside child and float64 threshold of each node
+const std::string_view VANTAGE_POINT_TREE_MAGIC = "VPT1";	// Magic number at the beginning of a vantage-point tree file.
+const uint32_t VANTAGE_POINT_TREE_VERSION = 2;				// Version of the vantage-point tree layout.
+const uint32_t VANTAGE_POINT_TREE_NONE = std::numeric_limits<uint32_t>::max();	// Index of a missing child node.
+
+
+/// <summary>
+/// Object of a feature store found by a query, together with its distance from the query.
+/// </summary>
+struct Neighbour {
+	uint index = 0;			// Index of the object in the feature store.
+	double distance = 0.0;	// Distance of the object from the query.
+
+	bool operator<(const Neighbour& other) const {
+		return distance < other.distance || (distance == other.distance && index < other.index);
+	}
+};
+
+
+/// <summary>
+/// Distance between two feature vectors: the largest difference of their chain lengths, where the missing chain lengths
+/// of the shorter feature vector are 0 (a metric, so it can be used for pruning).
+/// </summary>
+/// <param name="values1">: chain lengths of the first feature vector</param>
+/// <param name="values2">: chain lengths of the second feature vector</param>
+/// <returns>distance between the feature vectors</returns>
+double featureDistance(const std::span<const float> values1, const std::span<const float> values2);
+
+
+/// <summary>
+/// Metric index over the objects of a feature store for nearest-neighbour and radius queries.
+/// Each node splits the remaining objects by their median distance from a vantage point, so a query visits
+/// only the subtrees that can contain objects within the current search radius.
+/// The tree only stores object indices; the chain lengths are read from the (memory-mapped) feature store.
+/// </summary>
+class VantagePointTree {
+private:
+	// Node of the tree (objects closer to the vantage point than the threshold are in the inside subtree).
+	struct Node {
+		uint32_t object = 0;						// Index of the vantage point in the feature store.
+		uint32_t inside = VANTAGE_POINT_TREE_NONE;	// Subtree with the objects at most threshold away from the vantage point.
+		uint32_t outside = VANTAGE_POINT_TREE_NONE;	// Subtree with the objects at least threshold away from the vantage point.
+		double threshold = 0.0;						// Median distance of the objects in the subtrees from the vantage point.
+	};
+
+	const FeatureStore* store = nullptr;  // Feature store with the objects.
+	FeatureStoreFingerprint storeFingerprint;  // Fingerprint of the feature store the tree was built for.
+	std::vector<Node> nodes;			  // Nodes of the tree in pre-order (the root is the first node).
+
+	// Building the subtree of the objects in the given range and returning the index of its root.
+	uint32_t buildSubtree(std::vector<std::pair<double, uint32_t>>& objects, const size_t begin, const size_t end);
+
+	// Collecting the objects of a subtree within the radius, which shrinks to the farthest neighbour once k neighbours are found.
+	void search(const uint32_t node, const std::span<const float> query, const size_t k, double& radius, std::vector<Neighbour>& neighbours) const;
+
+public:
+	/// <summary>
+	/// Building the tree over all objects of a feature store.
+	/// </summary>
+	/// <param name="featureStore">: feature store with the objects (must outlive the tree)</param>
+	void build(const FeatureStore& featureStore);
+
+	/// <summary>
+	/// Reading a tree that was built for the given feature store (a tree of a rewritten feature store is rejected).
+	/// </summary>
+	/// <param name="path">: path to the tree file</param>
+	/// <param name="featureStore">: feature store with the objects (must outlive the tree)</param>
+	/// <param name="error">: description of the error (output)</param>
+	/// <returns>true if success, false otherwise</returns>
+	bool read(const std::string& path, const FeatureStore& featureStore, ParseError& error);
+
+	/// <summary>
+	/// Output of the tree into a file.
+	/// </summary>
+	/// <param name="path">: path to the tree file</param>
+	/// <returns>true if success, false otherwise</returns>
+	bool write(const std::string& path) const;
+
+	/// <summary>
+	/// Number of objects in the tree.
+	/// </summary>
+	/// <returns>number of objects</returns>
+	uint size() const;
+
+	/// <summary>
+	/// The k objects closest to the query.
+	/// </summary>
+	/// <param name="query">: chain lengths of the query</param>
+	/// <param name="k">: number of neighbours</param>
+	/// <returns>neighbours sorted by their distance from the query</returns>
+	std::vector<Neighbour> nearest(const std::span<const float> query, const uint k) const;
+
+	/// <summary>
+	/// All objects at most the given distance away from the query.
+	/// </summary>
+	/// <param name="query">: chain lengths of the query</param>
+	/// <param name="radius">: largest distance from the query</param>
+	/// <returns>neighbours sorted by their distance from the query</returns>
+	std::vector<Neighbour> withinRadius(const std::span<const float> query, const double radius) const;
+};
\ No newline at end of file